@@ -0,0 +1,70 @@
+/**
+ * @file asm_bench.cpp
+ * @brief Micro-benchmark of the assembly output of the ::CodeGenerator
+ *
+ * @details Usage: asm_bench [source] [count]
+ * The benchmark compiles the source (default test_inputs/gr_hazi.c, the largest
+ * test input) up to the syntax tree once, then generates its assembly count
+ * times (default 200) into a file, with and without comments, and measures
+ * the bytes of assembly written per second.
+ */
+#include "bench.h"
+
+#include "code_generator.h"
+#include "lexer.h"
+#include "parser.h"
+#include "preproc.h"
+#include "symbol.h"
+#include "type.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+/** @brief Generate the assembly of the translation unit count times and print the throughput */
+static void run(char const *name, TransUnitNode *trans, size_t count, bool asm_comments)
+{
+	TempFile output;
+	size_t nbytes = 0;
+	double secs = measure([&] {
+		std::ofstream ofs(output.name());
+		for (size_t i = 0; i < count; ++i)
+		{
+			CodeGenerator code_generator(ofs);
+			code_generator.set_asm_comments(asm_comments);
+			code_generator.generate_translation_unit(trans);
+			nbytes += code_generator.get_bytes_written();
+		}
+	});
+	report(name, secs, 0, nullptr, nbytes);
+}
+
+int main(int argc, char *argv[])
+{
+	char const *source = argc > 1 ? argv[1] : "test_inputs/gr_hazi.c";
+	size_t count = argc > 2 ? std::atoi(argv[2]) : 200;
+
+	return bench_main([&] {
+		std::string dir(source);
+		size_t slash = dir.rfind('/');
+		dir = slash == std::string::npos ? "." : dir.substr(0, slash);
+
+		Preprocessor prep;
+		prep.add_include_path(dir, false);
+		prep.process(source);
+		Lexer lexer;
+		lexer.lex_input(prep.get_token_list());
+		Parser parser(lexer.get_token_list());
+		if (!parser.parse())
+			throw "Could not parse program.";
+		parser.get_translation_unit()->constant_fold();
+
+		run("comments", parser.get_translation_unit(), count, true);
+		run("no comments", parser.get_translation_unit(), count, false);
+
+		AstNode::free_pool();
+		Type::free_pool();
+		Symbol::free_pool();
+		return 0;
+	});
+}
@@ -0,0 +1,127 @@
+/**
+ * @file bench.h
+ * @brief Common parts of the micro-benchmarks: generated input, timing and reporting
+ *
+ * @details The benchmarks are single translation units linked with the objects
+ * of the compiler, so the helpers are defined in this header.
+ */
+#ifndef BENCH_H_INCLUDED
+#define BENCH_H_INCLUDED
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <unistd.h>
+
+/**
+ * @brief Generate about mbytes megabytes of source text repeating the given lines
+ *
+ * @param lines printf formats terminated by nullptr, each %d or %x is replaced by the number of the repetition
+ */
+inline std::string generate_source(size_t mbytes, char const *const lines[])
+{
+	std::string src;
+	src.reserve(mbytes << 20);
+	char buf[512];
+	for (int n = 0; src.size() < (mbytes << 20); ++n)
+		for (size_t i = 0; lines[i] != nullptr; ++i)
+		{
+			snprintf(buf, sizeof buf, lines[i], n, n);
+			src += buf;
+		}
+	return src;
+}
+
+/** @brief A file with a unique name in the temporary directory, removed when the object is destroyed */
+class TempFile
+{
+public:
+	/** @brief Create the file with the given contents */
+	explicit TempFile(std::string const &contents = std::string())
+	{
+		std::string name = (std::filesystem::temp_directory_path() / "ccomp_bench.XXXXXX").string();
+		int fd = mkstemp(&name[0]);
+		if (fd < 0)
+			throw __FILE__ ": cannot create temporary file";
+		close(fd);
+		m_name = name;
+		std::ofstream ofs(m_name, std::ios::binary);
+		ofs << contents;
+		if (!ofs)
+		{
+			std::remove(m_name.c_str());
+			throw __FILE__ ": cannot write temporary file";
+		}
+	}
+
+	~TempFile() { std::remove(m_name.c_str()); }
+
+	TempFile(TempFile const &other) = delete;
+
+	TempFile const &operator=(TempFile const &other) = delete;
+
+	/** @brief Return the name of the file */
+	char const *name() const { return m_name.c_str(); }
+
+private:
+	std::string m_name;
+};
+
+/** @brief Return the seconds elapsed while calling f */
+template <class F>
+double measure(F &&f)
+{
+	auto start = std::chrono::steady_clock::now();
+	f();
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(stop - start).count();
+}
+
+/**
+ * @brief Print a line of results
+ *
+ * @param name the name of the run
+ * @param secs the elapsed time
+ * @param count the number of processed items, not printed if 0
+ * @param unit the name of the items
+ * @param nbytes the number of processed bytes, the throughput in MB/s is not printed if 0
+ */
+inline void report(std::string const &name, double secs, size_t count, char const *unit, size_t nbytes = 0)
+{
+	std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(3)
+			  << std::setw(9) << secs << " s";
+	if (count != 0)
+		std::cout << std::setw(11) << count << " " << unit
+				  << std::setw(9) << count / secs * 1e-6 << " M" << unit << "/s";
+	if (nbytes != 0)
+		std::cout << std::setw(9) << nbytes / secs / (1 << 20) << " MB/s";
+	std::cout << std::endl;
+}
+
+/** @brief Run the body of a benchmark, and return the exit status of the program */
+template <class F>
+int bench_main(F &&body)
+{
+	try
+	{
+		return body();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "Exception caught: " << e.what() << std::endl;
+	}
+	catch (char const *e)
+	{
+		std::cerr << "Exception caught: " << e << std::endl;
+	}
+	return 1;
+}
+
+#endif
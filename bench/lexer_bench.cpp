@@ -0,0 +1,61 @@
+/**
+ * @file lexer_bench.cpp
+ * @brief Micro-benchmark of the ::Lexer on a large synthetic input
+ *
+ * @details Usage: lexer_bench [megabytes]
+ * The benchmark generates C-like source text of the given size (default 16 MB),
+ * and measures the token throughput of both lexer entry points: lexing the
+ * text stream, and converting the pp-tokens of the preprocessor.
+ */
+#include "bench.h"
+
+#include "lexer.h"
+#include "preproc.h"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+/** @brief keyword and identifier heavy lines */
+static char const *const lines[] = {
+	"static unsigned long counter_%d = %d;\n",
+	"int function_%d(int argument, char const *name)\n",
+	"{\n",
+	"\tstruct point *p = &points[%d];\n",
+	"\tif (argument >= %d && name != 0)\n",
+	"\t\treturn p->x * argument + sizeof(double);\n",
+	"\twhile (argument-- > 0) { continue; }\n",
+	"\tswitch (argument) { case %d: break; default: break; }\n",
+	"\tfor (counter = 0; counter < %d; counter++) total += 1.5;\n",
+	"\treturn signed_value_%d <= unsigned_value;\n",
+	"}\n",
+	nullptr};
+
+int main(int argc, char *argv[])
+{
+	size_t mbytes = argc > 1 ? std::atoi(argv[1]) : 16;
+
+	return bench_main([&] {
+		std::string src = generate_source(mbytes, lines);
+
+		// lexing the text stream
+		{
+			std::istringstream is(src);
+			Lexer lexer;
+			double secs = measure([&] { lexer.lex_input(is); });
+			report("text", secs, lexer.get_token_list().size(), "tokens", src.size());
+		}
+
+		// converting pp-tokens, the preprocessor is not timed
+		{
+			TempFile input(src);
+			Preprocessor prep;
+			prep.process(input.name());
+
+			Lexer lexer;
+			double secs = measure([&] { lexer.lex_input(prep.get_token_list()); });
+			report("pp-tokens", secs, lexer.get_token_list().size(), "tokens", src.size());
+		}
+		return 0;
+	});
+}
@@ -0,0 +1,46 @@
+/**
+ * @file preproc_bench.cpp
+ * @brief Micro-benchmark of the tokenization of the ::Preprocessor
+ *
+ * @details Usage: preproc_bench [megabytes]
+ * The benchmark generates a source file of the given size (default 50 MB)
+ * mixing identifiers, numbers, literals, comments and punctuators, and
+ * measures the pp-token throughput of preprocessing it.
+ */
+#include "bench.h"
+
+#include "preproc.h"
+
+#include <cstdlib>
+#include <string>
+
+/** @brief source lines without macros */
+static char const *const lines[] = {
+	"/* block comment before function_%d */\n",
+	"static unsigned long counter_%d;\n",
+	"int function_%d(int argument, char const *name)\n",
+	"{\n",
+	"\tdouble x = 1.5e+3 * .25, y = 0x%xUL; // line comment\n",
+	"\tchar const *s = \"string literal %d\\n\", c = '\\'';\n",
+	"\tif (argument >= %d && name != 0 || !(x <= y))\n",
+	"\t\treturn p->x[%d] + sizeof(double) >> 2;\n",
+	"\tcounter_%d += argument-- ? argument ^ 7 : ~argument %% 3;\n",
+	"}\n",
+	nullptr};
+
+int main(int argc, char *argv[])
+{
+	size_t mbytes = argc > 1 ? std::atoi(argv[1]) : 50;
+
+	return bench_main([&] {
+		std::string src = generate_source(mbytes, lines);
+		size_t nbytes = src.size();
+		TempFile input(src);
+		src = std::string(); // the text is not kept in memory while preprocessing
+
+		Preprocessor prep;
+		double secs = measure([&] { prep.process(input.name()); });
+		report("preprocess", secs, prep.get_token_list().size(), "pp-tokens", nbytes);
+		return 0;
+	});
+}
@@ -0,0 +1,65 @@
+/**
+ * @file scan_bench.cpp
+ * @brief Micro-benchmark of the scanning functions of ::CharScan
+ *
+ * @details Usage: scan_bench [megabytes]
+ * The benchmark generates a comment-heavy and a string-heavy source file of
+ * the given size (default 20 MB), and measures the throughput of scanning them
+ * for directives, as the -M option does, and of preprocessing them with the
+ * scalar and SSE2 scanning functions, as far as the processor supports them.
+ */
+#include "bench.h"
+
+#include "char_scan.h"
+#include "preproc.h"
+
+#include <cstdlib>
+#include <string>
+
+/** @brief Scan or preprocess the file with each supported level and print the throughputs */
+static void run(char const *name, char const *fname, size_t nbytes, bool scan_only)
+{
+	for (int level = CharScan::SCALAR; level <= CharScan::supported_level(); ++level)
+	{
+		CharScan::set_level(static_cast<CharScan::Level>(level));
+		Preprocessor prep;
+		prep.set_scan_only(scan_only);
+		double secs = measure([&] { prep.process(fname); });
+		report(std::string(name) + (scan_only ? " scan " : " preprocess ") + CharScan::level_name(CharScan::get_level()),
+			   secs, 0, nullptr, nbytes);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	size_t mbytes = argc > 1 ? std::atoi(argv[1]) : 20;
+	static char const *const comments[] = {
+		"/*\n",
+		" * Block comment %d documenting the following declaration at length, so that\n",
+		" * most of the text is comment body: the scanner looks for the closing star\n",
+		" * and slash only, every other character * / is skipped without inspection.\n",
+		" */\n",
+		"int value_%d; // a trailing line comment of moderate length follows the code\n",
+		nullptr};
+	static char const *const strings[] = {
+		"char const *message_%d = \"a long string literal containing text, digits 0123456789 and symbols\";\n",
+		"char const *format_%d = \"with \\\"escaped quotes\\\", a tab\\t and a new line\\n in its body\";\n",
+		"\tputs(\"another literal passed to a function, as programs printing messages do\");\n",
+		nullptr};
+	struct
+	{
+		char const *name;
+		char const *const *lines;
+	} const inputs[] = {{"comments", comments}, {"strings", strings}};
+
+	return bench_main([&] {
+		for (auto const &input : inputs)
+		{
+			std::string src = generate_source(mbytes, input.lines);
+			TempFile file(src);
+			run(input.name, file.name(), src.size(), true);
+			run(input.name, file.name(), src.size(), false);
+		}
+		return 0;
+	});
+}
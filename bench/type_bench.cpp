@@ -0,0 +1,60 @@
+/**
+ * @file type_bench.cpp
+ * @brief Micro-benchmark of the construction of derived types in the ::Type pool
+ *
+ * @details Usage: type_bench [count]
+ * The benchmark builds count (default 100000) distinct array, pointer and
+ * function types derived from int, then builds the same types again, so that
+ * both the creation of new types and the lookup of existing ones are measured.
+ */
+#include "bench.h"
+
+#include "declaration.h"
+#include "symbol.h"
+#include "type.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/** @brief Build n derived types and return them */
+static std::vector<Type> build_types(size_t n)
+{
+	std::vector<Type> types;
+	types.reserve(n);
+	Type int_type = Type::int_type();
+	for (size_t i = 0; types.size() < n; ++i)
+	{
+		// int[i+1], int *[i+1] and int (*)(int[i+1])
+		Type array = int_type.array_of(i + 1);
+		types.push_back(array);
+		types.push_back(int_type.pointer_to().array_of(i + 1));
+		TypeNode::Declarations params(1, Declaration(array, "p"));
+		types.push_back(int_type.function_returning(params, false).pointer_to());
+	}
+	types.resize(n);
+	return types;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t count = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+	return bench_main([&] {
+		std::vector<Type> created, found;
+		double secs = measure([&] { created = build_types(count); });
+		report("create", secs, created.size(), "types");
+		secs = measure([&] { found = build_types(count); });
+		report("lookup", secs, found.size(), "types");
+
+		if (created != found)
+		{
+			std::cerr << "Type pool returned different types for the same construction" << std::endl;
+			return 1;
+		}
+
+		Type::free_pool();
+		Symbol::free_pool();
+		return 0;
+	});
+}
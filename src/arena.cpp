@@ -0,0 +1,31 @@
+#include "arena.h"
+
+#include <algorithm>
+
+void *Arena::allocate_block(size_t size, size_t alignment)
+{
+	// oversized requests get a block of their own, the current block remains in use
+	size_t bytes = std::max(size + alignment, block_size);
+	char *block = static_cast<char *>(::operator new(bytes));
+	m_blocks.push_back(block);
+	char *ptr = block + (-reinterpret_cast<uintptr_t>(block) & (alignment - 1));
+	if (bytes == block_size)
+	{
+		m_next = ptr + size;
+		m_end = block + bytes;
+	}
+	m_allocated += size;
+	return ptr;
+}
+
+void Arena::release()
+{
+	for (auto it = m_finalizers.rbegin(); it != m_finalizers.rend(); ++it)
+		it->second(it->first);
+	m_finalizers.clear();
+	for (auto b : m_blocks)
+		::operator delete(b);
+	m_blocks.clear();
+	m_next = m_end = nullptr;
+	m_allocated = 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file arena.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::Arena
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Bump allocator for objects living until the end of the compilation
+ *
+ * @details Memory is handed out from large blocks by advancing a pointer,
+ * and all blocks are freed together by release().
+ * Objects with nontrivial destructors register a finalizer. The finalizers
+ * are called in reverse order of registration before the blocks are freed,
+ * so objects never need to destroy each other.
+ */
+class Arena
+{
+public:
+	/** @brief Construct an empty arena */
+	Arena() : m_next(nullptr), m_end(nullptr), m_allocated(0) { }
+
+	/** @brief Destroy the objects of the arena and free its memory */
+	~Arena() { release(); }
+
+	Arena(Arena const &other) = delete;
+
+	Arena const &operator=(Arena const &other) = delete;
+
+	/** @brief Allocate uninitialized memory with the given alignment */
+	void *allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+	{
+		size_t pad = -reinterpret_cast<uintptr_t>(m_next) & (alignment - 1);
+		if (size + pad > static_cast<size_t>(m_end - m_next))
+			return allocate_block(size, alignment);
+		void *ptr = m_next + pad;
+		m_next += size + pad;
+		m_allocated += size;
+		return ptr;
+	}
+
+	/** @brief Register an object allocated in the arena to be destroyed by release() */
+	template <class T>
+	void add_finalizer(T *obj)
+	{
+		m_finalizers.emplace_back(obj, [](void *p) { static_cast<T *>(p)->~T(); });
+	}
+
+	/** @brief Construct an object in the arena */
+	template <class T, class... Args>
+	T *create(Args &&...args)
+	{
+		// the global placement new, the class may have its own operator new
+		T *obj = ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		if (!std::is_trivially_destructible<T>::value)
+			add_finalizer(obj);
+		return obj;
+	}
+
+	/** @brief Destroy the registered objects and free all memory of the arena */
+	void release();
+
+	/** @brief Return the number of bytes allocated since the last release */
+	size_t get_allocated_bytes() const { return m_allocated; }
+
+private:
+	/** @brief Start a new block and allocate from it */
+	void *allocate_block(size_t size, size_t alignment);
+
+	/** @brief the default size of the memory blocks */
+	static constexpr size_t block_size = 64 * 1024;
+
+	std::vector<char *> m_blocks;
+	char *m_next;
+	char *m_end;
+	size_t m_allocated;
+	/** @brief objects to destroy and their destructors */
+	std::vector<std::pair<void *, void (*)(void *)>> m_finalizers;
+};
+
+#endif
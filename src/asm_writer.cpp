@@ -0,0 +1,71 @@
+#include "asm_writer.h"
+
+AsmWriter::AsmWriter(std::ostream &os)
+	: m_os(os), m_bytes_written(0)
+{
+	m_buffer.reserve(buffer_size + 1024);
+}
+
+void AsmWriter::pad(size_t start, size_t width)
+{
+	size_t end = start + width;
+	if (m_buffer.size() < end)
+		m_buffer.append(end - m_buffer.size(), ' ');
+}
+
+void AsmWriter::instruction(Instruction const &instr)
+{
+	std::string_view comment = instr.get_comment();
+	if (instr.get_opcode() == Instruction::LABEL)
+	{
+		instr.get_src().print(m_buffer);
+		m_buffer += ':';
+		if (!comment.empty())
+		{
+			m_buffer += "\t# ";
+			m_buffer += comment;
+		}
+		m_buffer += '\n';
+	}
+	else if (instr.get_opcode() != Instruction::NONE || !comment.empty())
+	{
+		// the columns are the mnemonic, the operands and the comment, at least 8, 24 and 8 characters wide
+		m_buffer += '\t';
+		size_t start = m_buffer.size();
+		instr.print_mnemonic(m_buffer);
+		pad(start, 8);
+		m_buffer += ' ';
+		start = m_buffer.size();
+		instr.get_src().print(m_buffer);
+		if (instr.get_dst().get_kind() != Operand::NONE)
+		{
+			m_buffer += ", ";
+			instr.get_dst().print(m_buffer);
+		}
+		pad(start, 24);
+		if (!comment.empty())
+		{
+			m_buffer += ' ';
+			start = m_buffer.size();
+			m_buffer += "# ";
+			m_buffer += comment;
+			pad(start, 8);
+		}
+		m_buffer += '\n';
+	}
+	if (m_buffer.size() >= buffer_size)
+		write_buffer();
+}
+
+void AsmWriter::write_buffer()
+{
+	m_os.write(m_buffer.data(), m_buffer.size());
+	m_bytes_written += m_buffer.size();
+	m_buffer.clear();
+}
+
+void AsmWriter::flush()
+{
+	write_buffer();
+	m_os.flush();
+}
@@ -0,0 +1,66 @@
+/**
+ * @file asm_writer.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::AsmWriter
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ASM_WRITER_H_INCLUDED
+#define ASM_WRITER_H_INCLUDED
+
+#include "instruction.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Formatter of assembly lines into an append-only buffer
+ *
+ * @details Instructions are formatted into a large buffer without iostream manipulators.
+ * The buffer is handed to the output stream when it fills up, and the stream
+ * is flushed once by flush(), at the end of the output.
+ */
+class AsmWriter
+{
+public:
+	/** @brief Construct a writer of the given stream */
+	AsmWriter(std::ostream &os);
+
+	/** @brief Write the buffered lines to the stream */
+	~AsmWriter() { flush(); }
+
+	AsmWriter(AsmWriter const &other) = delete;
+
+	AsmWriter const &operator=(AsmWriter const &other) = delete;
+
+	/** @brief Append the line of an instruction, a directive or a label, comment lines without comment are omitted */
+	void instruction(Instruction const &instr);
+
+	/** @brief Write the buffered lines to the stream and flush it */
+	void flush();
+
+	/** @brief Return the number of bytes appended so far */
+	size_t get_bytes_written() const { return m_bytes_written + m_buffer.size(); }
+
+private:
+	/** @brief Append spaces until the text from position start is width characters long */
+	void pad(size_t start, size_t width);
+
+	/** @brief Hand the buffered lines to the stream without flushing it */
+	void write_buffer();
+
+	/** @brief the size above which the buffer is handed to the stream */
+	static constexpr size_t buffer_size = 1 << 20;
+
+	std::ostream &m_os;
+	std::string m_buffer;
+	/** @brief the number of bytes handed to the stream */
+	size_t m_bytes_written;
+};
+
+#endif
@@ -0,0 +1,575 @@
+#include "assembler.h"
+
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+
+/** @brief Return the bytes of a string literal with its escape sequences replaced */
+static std::string decode_string(std::string const &str)
+{
+	std::string out;
+	for (size_t i = 0; i < str.size(); ++i)
+	{
+		if (str[i] != '\\' || i + 1 == str.size())
+		{
+			out += str[i];
+			continue;
+		}
+		char c = str[++i];
+		switch (c)
+		{
+		case 'n':
+			out += '\n';
+			break;
+		case 't':
+			out += '\t';
+			break;
+		case 'r':
+			out += '\r';
+			break;
+		case 'a':
+			out += '\a';
+			break;
+		case 'b':
+			out += '\b';
+			break;
+		case 'f':
+			out += '\f';
+			break;
+		case 'v':
+			out += '\v';
+			break;
+		case 'x':
+		{
+			unsigned value = 0;
+			while (i + 1 < str.size() && isxdigit(static_cast<unsigned char>(str[i + 1])))
+			{
+				char d = str[++i];
+				value = value * 16 + (isdigit(static_cast<unsigned char>(d)) ? d - '0' : (d | 0x20) - 'a' + 10);
+			}
+			out += char(value);
+			break;
+		}
+		default:
+			if (c >= '0' && c <= '7')
+			{
+				unsigned value = c - '0';
+				for (int n = 1; n < 3 && i + 1 < str.size() && str[i + 1] >= '0' && str[i + 1] <= '7'; ++n)
+					value = value * 8 + (str[++i] - '0');
+				out += char(value);
+			}
+			else // \\, \', \" and \?
+				out += c;
+		}
+	}
+	return out;
+}
+
+Assembler::Assembler()
+	: m_section(ElfObject::TEXT), m_code(&m_object.contents(ElfObject::TEXT)), m_byte_rex(false)
+{
+}
+
+unsigned Assembler::number(Register::Id id)
+{
+	switch (id)
+	{
+	case Register::Id::AX:
+		return 0;
+	case Register::Id::CX:
+		return 1;
+	case Register::Id::DX:
+		return 2;
+	case Register::Id::BX:
+		return 3;
+	case Register::Id::SP:
+		return 4;
+	case Register::Id::BP:
+		return 5;
+	case Register::Id::SI:
+		return 6;
+	case Register::Id::DI:
+		return 7;
+	case Register::Id::NO_REGISTER:
+		throw __FILE__ ": missing register";
+	default:
+		// r8-r15 and xmm0-xmm15 are numbered in order
+		if (id < Register::Id::XMM0)
+			return 8 + static_cast<unsigned>(id) - static_cast<unsigned>(Register::Id::R8);
+		return static_cast<unsigned>(id) - static_cast<unsigned>(Register::Id::XMM0);
+	}
+}
+
+void Assembler::put(unsigned long long value, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		*m_code += char(value >> 8 * i);
+}
+
+void Assembler::encode(unsigned prefix, bool rex_w, unsigned opcode, unsigned reg, Operand const &rm, size_t imm_size, long long imm)
+{
+	Operand::Kind kind = rm.get_kind();
+	bool has_index = kind == Operand::MEMORY && rm.get_index() != Register::Id::NO_REGISTER;
+	unsigned base = kind == Operand::REGISTER || kind == Operand::INDIRECT || kind == Operand::MEMORY ? number(rm.get_base()) : 0;
+	unsigned index = has_index ? number(rm.get_index()) : 0;
+
+	if (prefix != 0)
+		put(prefix, 1);
+	unsigned rex = (rex_w ? 8 : 0) | (reg >> 3) << 2 | (index >> 3) << 1 | base >> 3;
+	if (rex != 0 || m_byte_rex)
+		put(0x40 | rex, 1);
+	if (opcode > 0xff)
+		put(0x0f, 1);
+	put(opcode & 0xff, 1);
+
+	reg &= 7;
+	switch (kind)
+	{
+	case Operand::REGISTER:
+	case Operand::INDIRECT:
+		put(0xc0 | reg << 3 | (base & 7), 1);
+		break;
+	case Operand::MEMORY:
+	{
+		// rbp and r13 bases need a displacement, rsp and r12 bases need a SIB byte
+		long long disp = rm.get_value();
+		unsigned mod = disp == 0 && (base & 7) != 5 ? 0 : is_byte(disp) ? 1 : 2;
+		bool sib = has_index || (base & 7) == 4;
+		put(mod << 6 | reg << 3 | (sib ? 4 : base & 7), 1);
+		if (sib)
+		{
+			size_t scale = rm.get_scale();
+			unsigned ss = scale == 8 ? 3 : scale == 4 ? 2 : scale == 2 ? 1 : 0;
+			put(ss << 6 | (has_index ? index & 7 : 4) << 3 | (base & 7), 1);
+		}
+		if (mod == 1)
+			put(disp, 1);
+		else if (mod == 2)
+			put(disp, 4);
+		break;
+	}
+	case Operand::LABEL_RIP:
+		// the displacement is relative to the end of the instruction, after the immediate
+		put(reg << 3 | 5, 1);
+		m_fixups.push_back(Fixup{m_section, m_code->size(), rm.get_value(), -static_cast<long long>(4 + imm_size)});
+		put(0, 4);
+		break;
+	case Operand::SYMBOL_RIP:
+	case Operand::SYMBOL_GOT:
+		put(reg << 3 | 5, 1);
+		m_object.add_relocation(m_section, m_code->size(), symbol(rm),
+								kind == Operand::SYMBOL_RIP ? ElfObject::R_X86_64_PC32 : ElfObject::R_X86_64_GOTPCREL,
+								-static_cast<long long>(4 + imm_size));
+		put(0, 4);
+		break;
+	default:
+		throw __FILE__ ": invalid register or memory operand";
+	}
+	put(imm, imm_size);
+}
+
+void Assembler::arithmetic(Instruction const &instr, unsigned opcode, unsigned extension)
+{
+	size_t size = instr.get_size();
+	unsigned prefix = size == 2 ? 0x66 : 0;
+	bool rex_w = size == 8;
+	Operand const &src = instr.get_src(), &dst = instr.get_dst();
+	if (src.get_kind() == Operand::IMMEDIATE)
+	{
+		long long imm = src.get_value();
+		if (size == 1)
+			encode(prefix, rex_w, 0x80, extension, dst, 1, imm);
+		else if (is_byte(imm))
+			encode(prefix, rex_w, 0x83, extension, dst, 1, imm);
+		else
+			encode(prefix, rex_w, 0x81, extension, dst, size == 2 ? 2 : 4, imm);
+	}
+	else if (src.get_kind() == Operand::REGISTER)
+		encode(prefix, rex_w, opcode + (size == 1 ? 0 : 1), number(src.get_base()), dst);
+	else
+		encode(prefix, rex_w, opcode + (size == 1 ? 2 : 3), number(dst.get_base()), src);
+}
+
+void Assembler::scalar(Instruction const &instr, unsigned opcode, unsigned reg, Operand const &rm)
+{
+	encode(instr.get_size() == 8 ? 0xf2 : 0xf3, false, opcode, reg, rm);
+}
+
+void Assembler::unary(Instruction const &instr, unsigned extension)
+{
+	size_t size = instr.get_size();
+	encode(size == 2 ? 0x66 : 0, size == 8, size == 1 ? 0xf6 : 0xf7, extension, instr.get_src());
+}
+
+void Assembler::jump(Instruction::Opcode opcode, Operand const &target)
+{
+	if (target.get_kind() != Operand::LABEL)
+		throw __FILE__ ": jump target should be a label";
+	// the jumps are short until relax() finds them out of range
+	size_t index = m_jumps.size();
+	if (index == m_near.size())
+		m_near.push_back(false);
+	bool near = m_near[index];
+	if (opcode == Instruction::JMP)
+		put(near ? 0xe9 : 0xeb, 1);
+	else
+	{
+		unsigned cc;
+		switch (opcode)
+		{
+		case Instruction::JE:
+		case Instruction::JZ:
+			cc = 0x4;
+			break;
+		case Instruction::JNE:
+		case Instruction::JNZ:
+			cc = 0x5;
+			break;
+		case Instruction::JL:
+			cc = 0xc;
+			break;
+		case Instruction::JLE:
+			cc = 0xe;
+			break;
+		case Instruction::JG:
+			cc = 0xf;
+			break;
+		case Instruction::JGE:
+			cc = 0xd;
+			break;
+		case Instruction::JB:
+			cc = 0x2;
+			break;
+		case Instruction::JBE:
+			cc = 0x6;
+			break;
+		case Instruction::JA:
+			cc = 0x7;
+			break;
+		case Instruction::JAE:
+			cc = 0x3;
+			break;
+		default:
+			throw __FILE__ ": invalid jump";
+		}
+		if (near)
+			put(0x0f, 1);
+		put((near ? 0x80 : 0x70) | cc, 1);
+	}
+	m_jumps.push_back(Jump{m_section, m_code->size(), target.get_value(), near});
+	put(0, near ? 4 : 1);
+}
+
+void Assembler::mov(Instruction const &instr)
+{
+	size_t size = instr.get_size();
+	unsigned prefix = size == 2 ? 0x66 : 0;
+	bool rex_w = size == 8;
+	Operand const &src = instr.get_src(), &dst = instr.get_dst();
+	for (Operand const *op : {&src, &dst})
+		if (op->get_kind() == Operand::REGISTER && op->get_register().get_type() == Register::Type::FLOATING)
+			throw __FILE__ ": floating point register in integer move";
+	if (src.get_kind() == Operand::IMMEDIATE)
+	{
+		long long imm = src.get_value();
+		bool imm32 = imm >= INT32_MIN && imm <= INT32_MAX;
+		if (dst.get_kind() != Operand::REGISTER)
+		{
+			if (size == 8 && !imm32)
+				throw __FILE__ ": immediate out of range";
+			encode(prefix, rex_w, size == 1 ? 0xc6 : 0xc7, 0, dst, size == 8 ? 4 : size, imm);
+		}
+		else if (size == 8 && imm32)
+			encode(prefix, rex_w, 0xc7, 0, dst, 4, imm); // sign extended
+		else
+		{
+			// the register is encoded in the opcode
+			unsigned reg = number(dst.get_base());
+			if (prefix != 0)
+				put(prefix, 1);
+			if (rex_w || reg >= 8 || m_byte_rex)
+				put(0x40 | (rex_w ? 8 : 0) | reg >> 3, 1);
+			put((size == 1 ? 0xb0 : 0xb8) + (reg & 7), 1);
+			put(imm, size);
+		}
+	}
+	else if (src.get_kind() == Operand::REGISTER)
+		encode(prefix, rex_w, size == 1 ? 0x88 : 0x89, number(src.get_base()), dst);
+	else
+		encode(prefix, rex_w, size == 1 ? 0x8a : 0x8b, number(dst.get_base()), src);
+}
+
+void Assembler::directive(Instruction const &instr)
+{
+	Operand const &src = instr.get_src(), &dst = instr.get_dst();
+	switch (instr.get_opcode())
+	{
+	case Instruction::DATA:
+		m_section = ElfObject::DATA;
+		break;
+	case Instruction::BSS:
+		m_section = ElfObject::BSS;
+		break;
+	case Instruction::TEXT:
+		m_section = ElfObject::TEXT;
+		break;
+	case Instruction::SECTION:
+		if (strcmp(src.get_text(), ".rodata") != 0)
+			throw __FILE__ ": unknown section";
+		m_section = ElfObject::RODATA;
+		break;
+	case Instruction::GLOBL:
+		m_object.set_global(symbol(src));
+		break;
+	case Instruction::TYPE:
+		m_object.set_type(symbol(src), strcmp(dst.get_text(), "@function") == 0 ? ElfObject::STT_FUNC : ElfObject::STT_OBJECT);
+		break;
+	case Instruction::SIZE:
+		m_object.set_size(symbol(src), dst.get_value());
+		break;
+	case Instruction::ALIGN:
+		m_object.align(m_section, src.get_value());
+		break;
+	case Instruction::ZERO:
+		m_object.append_zeros(m_section, src.get_value());
+		break;
+	case Instruction::STRING:
+		*m_code += decode_string(src.get_symbol().str());
+		*m_code += '\0';
+		break;
+	case Instruction::LONG:
+		put(src.get_value(), 4);
+		break;
+	default:
+		throw __FILE__ ": invalid directive";
+	}
+	m_code = &m_object.contents(m_section);
+}
+
+void Assembler::assemble(Instruction const &instr)
+{
+	Operand const &src = instr.get_src(), &dst = instr.get_dst();
+	Instruction::Opcode opcode = instr.get_opcode();
+	if (opcode == Instruction::NONE)
+		return;
+	if (opcode == Instruction::LABEL)
+	{
+		size_t offset = m_object.get_size(m_section);
+		if (src.get_kind() == Operand::LABEL)
+			m_labels[src.get_value()] = std::make_pair(m_section, offset);
+		else
+			m_object.define_symbol(symbol(src), m_section, offset);
+		return;
+	}
+	if (opcode < Instruction::MOV)
+	{
+		directive(instr);
+		return;
+	}
+	if (m_section == ElfObject::BSS)
+		throw __FILE__ ": instruction in .bss";
+
+	// spl, bpl, sil and dil are only accessible with a REX prefix
+	m_byte_rex = false;
+	for (Operand const *op : {&src, &dst})
+		if (op->get_kind() == Operand::REGISTER && op->get_register().get_size() == 1)
+		{
+			unsigned reg = number(op->get_base());
+			m_byte_rex = m_byte_rex || (reg >= 4 && reg < 8);
+		}
+
+	size_t size = instr.get_size();
+	bool floating = instr.get_type() == Register::Type::FLOATING;
+	unsigned prefix = size == 2 ? 0x66 : 0;
+	switch (opcode)
+	{
+	case Instruction::MOV:
+		if (!floating)
+			mov(instr);
+		else if (dst.get_kind() == Operand::REGISTER)
+			scalar(instr, 0x0f10, number(dst.get_base()), src);
+		else
+			scalar(instr, 0x0f11, number(src.get_base()), dst);
+		break;
+	case Instruction::MOVS:
+	case Instruction::MOVZ:
+	{
+		size_t from = instr.get_source_size();
+		if (from == 4 && opcode == Instruction::MOVZ)
+			encode(0, false, 0x8b, number(dst.get_base()), src); // 32 bit moves clear the upper half
+		else if (from == 4)
+			encode(0, true, 0x63, number(dst.get_base()), src);
+		else
+			encode(prefix, size == 8, (opcode == Instruction::MOVS ? 0x0fbe : 0x0fb6) + (from == 2 ? 1 : 0), number(dst.get_base()), src);
+		break;
+	}
+	case Instruction::LEA:
+		encode(prefix, size == 8, 0x8d, number(dst.get_base()), src);
+		break;
+	case Instruction::ADD:
+		if (floating)
+			scalar(instr, 0x0f58, number(dst.get_base()), src);
+		else
+			arithmetic(instr, 0x00, 0);
+		break;
+	case Instruction::SUB:
+		if (floating)
+			scalar(instr, 0x0f5c, number(dst.get_base()), src);
+		else
+			arithmetic(instr, 0x28, 5);
+		break;
+	case Instruction::CMP:
+		arithmetic(instr, 0x38, 7);
+		break;
+	case Instruction::IMUL:
+		if (src.get_kind() != Operand::IMMEDIATE)
+			encode(prefix, size == 8, 0x0faf, number(dst.get_base()), src);
+		else if (is_byte(src.get_value()))
+			encode(prefix, size == 8, 0x6b, number(dst.get_base()), dst, 1, src.get_value());
+		else
+			encode(prefix, size == 8, 0x69, number(dst.get_base()), dst, size == 2 ? 2 : 4, src.get_value());
+		break;
+	case Instruction::MUL:
+		if (floating)
+			scalar(instr, 0x0f59, number(dst.get_base()), src);
+		else
+			unary(instr, 4);
+		break;
+	case Instruction::DIV:
+		if (floating)
+			scalar(instr, 0x0f5e, number(dst.get_base()), src);
+		else
+			unary(instr, 6);
+		break;
+	case Instruction::IDIV:
+		unary(instr, 7);
+		break;
+	case Instruction::NEG:
+		unary(instr, 3);
+		break;
+	case Instruction::COMI:
+		encode(size == 8 ? 0x66 : 0, false, 0x0f2f, number(dst.get_base()), src);
+		break;
+	case Instruction::TEST:
+		encode(prefix, size == 8, size == 1 ? 0x84 : 0x85, number(src.get_base()), dst);
+		break;
+	case Instruction::PXOR:
+		encode(0x66, false, 0x0fef, number(dst.get_base()), src);
+		break;
+	case Instruction::CVTSI2:
+		encode(size == 8 ? 0xf2 : 0xf3, src.get_register().get_size() == 8, 0x0f2a, number(dst.get_base()), src);
+		break;
+	case Instruction::CVTSD2SI:
+		encode(0xf2, dst.get_register().get_size() == 8, 0x0f2d, number(dst.get_base()), src);
+		break;
+	case Instruction::CWD:
+		put(0x66, 1);
+		put(0x99, 1);
+		break;
+	case Instruction::CDQ:
+		put(0x99, 1);
+		break;
+	case Instruction::CQO:
+		put(0x48, 1);
+		put(0x99, 1);
+		break;
+	case Instruction::PUSH:
+	case Instruction::POP:
+	{
+		unsigned reg = number(src.get_base());
+		if (reg >= 8)
+			put(0x41, 1);
+		put((opcode == Instruction::PUSH ? 0x50 : 0x58) + (reg & 7), 1);
+		break;
+	}
+	case Instruction::CALL:
+		if (src.get_kind() == Operand::INDIRECT)
+			encode(0, false, 0xff, 2, src);
+		else
+		{
+			put(0xe8, 1);
+			m_object.add_relocation(m_section, m_code->size(), symbol(src), ElfObject::R_X86_64_PLT32, -4);
+			put(0, 4);
+		}
+		break;
+	case Instruction::RET:
+		put(0xc3, 1);
+		break;
+	default:
+		jump(opcode, src);
+	}
+}
+
+std::pair<ElfObject::Section, size_t> const &Assembler::label(long long label) const
+{
+	auto it = m_labels.find(label);
+	if (it == m_labels.end())
+		throw __FILE__ ": reference of an undefined label";
+	return it->second;
+}
+
+long long Assembler::displacement(Jump const &jump) const
+{
+	auto const &target = label(jump.label);
+	if (target.first != jump.section)
+		throw __FILE__ ": jump to another section";
+	return static_cast<long long>(target.second) - static_cast<long long>(jump.offset + (jump.near ? 4 : 1));
+}
+
+void Assembler::assemble_all()
+{
+	m_object = ElfObject();
+	m_section = ElfObject::TEXT;
+	m_code = &m_object.contents(m_section);
+	m_labels.clear();
+	m_fixups.clear();
+	m_jumps.clear();
+	for (auto const &instr : m_instructions)
+		assemble(instr);
+}
+
+bool Assembler::relax()
+{
+	bool relaxed = false;
+	for (size_t i = 0; i < m_jumps.size(); ++i)
+		if (!m_jumps[i].near && !is_byte(displacement(m_jumps[i])))
+		{
+			m_near[i] = true;
+			relaxed = true;
+		}
+	return relaxed;
+}
+
+void Assembler::patch(ElfObject::Section section, size_t offset, long long value, size_t n)
+{
+	std::string &code = m_object.contents(section);
+	for (size_t i = 0; i < n; ++i)
+		code[offset + i] = char(value >> 8 * i);
+}
+
+void Assembler::flush(std::ostream &os)
+{
+	// a near jump moves the code following it, so the jumps are checked again until none of them grows,
+	// as in the relaxation of gas, near jumps never become short again
+	assemble_all();
+	while (relax())
+		assemble_all();
+	for (auto const &jump : m_jumps)
+		patch(jump.section, jump.offset, displacement(jump), jump.near ? 4 : 1);
+
+	for (auto const &fixup : m_fixups)
+	{
+		auto const &target = label(fixup.label);
+		if (target.first == fixup.section)
+			patch(fixup.section, fixup.offset, static_cast<long long>(target.second) + fixup.addend - static_cast<long long>(fixup.offset), 4);
+		else
+		{
+			// references of other sections are relocated relative to the section
+			size_t sym = m_object.section_symbol(target.first);
+			m_object.add_relocation(fixup.section, fixup.offset, sym, ElfObject::R_X86_64_PC32,
+									static_cast<long long>(target.second) + fixup.addend);
+		}
+	}
+	m_object.write(os);
+	os.flush();
+}
@@ -0,0 +1,147 @@
+/**
+ * @file assembler.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::Assembler
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ASSEMBLER_H_INCLUDED
+#define ASSEMBLER_H_INCLUDED
+
+#include "elf_object.h"
+#include "instruction.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Encoder of instructions into an ELF relocatable object
+ *
+ * @details The assembler collects the instructions of a translation unit, and
+ * encodes the x86-64 subset generated by ::CodeGenerator into the sections of an
+ * ::ElfObject in flush(). Jumps get the short form if their targets are in
+ * range, so the code is encoded again whenever a jump has to be made near.
+ * References of local labels are patched when the object is written,
+ * references of other sections and symbols are relocated.
+ */
+class Assembler
+{
+public:
+	/** @brief Construct an assembler with empty sections */
+	Assembler();
+
+	Assembler(Assembler const &other) = delete;
+
+	Assembler const &operator=(Assembler const &other) = delete;
+
+	/** @brief Add an instruction, a directive or a label to the translation unit */
+	void instruction(Instruction const &instr) { m_instructions.push_back(instr); }
+
+	/** @brief Encode the translation unit, resolve the references of the labels and write the object to a stream */
+	void flush(std::ostream &os);
+
+private:
+	/** @brief 32 bit pc-relative reference of a local label */
+	struct Fixup
+	{
+		ElfObject::Section section;
+		size_t offset;
+		long long label;
+		long long addend;
+	};
+
+	/** @brief pc-relative jump to a local label */
+	struct Jump
+	{
+		ElfObject::Section section;
+		/** @brief the offset of the displacement */
+		size_t offset;
+		long long label;
+		/** @brief the displacement has 32 bits instead of 8 */
+		bool near;
+	};
+
+	/** @brief Return the encoding of a register in the ModRM, SIB and REX fields */
+	static unsigned number(Register::Id id);
+
+	/** @brief Determine if a value fits into a signed byte */
+	static bool is_byte(long long value) { return value >= -128 && value <= 127; }
+
+	/** @brief Append little endian bytes to the current section */
+	void put(unsigned long long value, size_t n);
+
+	/**
+	 * @brief Encode an instruction with a ModRM operand
+	 *
+	 * @param prefix mandatory or operand size prefix, 0 if none
+	 * @param rex_w 64 bit operand size
+	 * @param opcode one byte, or two bytes after 0x0f
+	 * @param reg register number or opcode extension of the reg field
+	 * @param rm register or memory operand of the r/m field
+	 * @param imm_size the size of the immediate following the operand
+	 * @param imm the immediate
+	 */
+	void encode(unsigned prefix, bool rex_w, unsigned opcode, unsigned reg, Operand const &rm, size_t imm_size = 0, long long imm = 0);
+
+	/** @brief Encode add, sub or cmp of integers */
+	void arithmetic(Instruction const &instr, unsigned opcode, unsigned extension);
+
+	/** @brief Encode a scalar floating point instruction */
+	void scalar(Instruction const &instr, unsigned opcode, unsigned reg, Operand const &rm);
+
+	/** @brief Encode an instruction with a single integer operand */
+	void unary(Instruction const &instr, unsigned extension);
+
+	/** @brief Encode a jump to a label, the condition code is ignored by jmp */
+	void jump(Instruction::Opcode opcode, Operand const &target);
+
+	/** @brief Encode the move of an integer */
+	void mov(Instruction const &instr);
+
+	/** @brief Encode a directive */
+	void directive(Instruction const &instr);
+
+	/** @brief Encode an instruction, a directive or a label into the current section */
+	void assemble(Instruction const &instr);
+
+	/** @brief Encode the translation unit from the beginning, with the current sizes of the jumps */
+	void assemble_all();
+
+	/** @brief Make the short jumps out of range near, and determine if any of them has changed */
+	bool relax();
+
+	/** @brief Return the section and offset of a label, an undefined label is an error of the code generator */
+	std::pair<ElfObject::Section, size_t> const &label(long long label) const;
+
+	/** @brief Return the displacement of a jump to its target */
+	long long displacement(Jump const &jump) const;
+
+	/** @brief Overwrite n bytes of a section with a little endian value */
+	void patch(ElfObject::Section section, size_t offset, long long value, size_t n);
+
+	/** @brief Return the index of the symbol of an operand */
+	size_t symbol(Operand const &op) { return m_object.symbol(op.get_symbol().str()); }
+
+	ElfObject m_object;
+	ElfObject::Section m_section;
+	/** @brief the contents of the current section */
+	std::string *m_code;
+	/** @brief the instruction being encoded has byte registers needing a REX prefix */
+	bool m_byte_rex;
+	/** @brief the sections and offsets of the labels */
+	std::unordered_map<long long, std::pair<ElfObject::Section, size_t>> m_labels;
+	std::vector<Fixup> m_fixups;
+	std::vector<Jump> m_jumps;
+	/** @brief the jumps made near, in the order of the jumps */
+	std::vector<bool> m_near;
+	std::vector<Instruction> m_instructions;
+};
+
+#endif
@@ -68,7 +68,7 @@ public:
 
 	virtual XprNode *clone() override
 	{
-		XprNode *c = new AssignmentXprNode(*this);
+		XprNode *c = create<AssignmentXprNode>(*this);
 		for (auto x : get_subxprs())
 			c->add_subxpr(x->clone());
 		return c;
@@ -3,12 +3,7 @@
 #include "integer_constant.h"
 #include "xpr_node.h"
 
-AstNode::~AstNode()
-{
-	for (auto c : m_subxprs)
-		delete c;
-	// substatements do not need to be deleted as they are contained via shared pointers
-}
+Arena AstNode::m_arena;
 
 void AstNode::set_subxpr(size_t i, XprNode *c)
 {
@@ -24,7 +19,7 @@ void AstNode::add_subxpr(XprNode *c)
 		c->m_parent = this;
 }
 
-void AstNode::add_substm(std::shared_ptr<StmNode> const &c)
+void AstNode::add_substm(StmNode *c)
 {
 	m_substms.push_back(c);
 	if (c != nullptr)
@@ -45,8 +40,7 @@ void AstNode::constant_fold()
 			continue;
 		if (get_subxpr(i)->get_id() == XprNode::Id::INTEGER_XPR)
 		{
-			IntegerConstant *ixpr = new IntegerConstant(get_subxpr(i)->evaluate_constant());
-			delete get_subxpr(i);
+			IntegerConstant *ixpr = create<IntegerConstant>(get_subxpr(i)->evaluate_constant());
 			set_subxpr(i, ixpr);
 		}
 	}
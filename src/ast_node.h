@@ -11,13 +11,14 @@
 #ifndef NODE_H_INCLUDED
 #define NODE_H_INCLUDED
 
+#include "arena.h"
 #include "type.h"
 #include "serializable.h"
 #include "symbol_tree.h"
 
 #include <iostream>
+#include <utility>
 #include <vector>
-#include <memory> // std::shared_ptr
 
 /**
  * @brief Forward declaration of class XprNode, as each node contains pointers to subexpressions
@@ -32,22 +33,37 @@ class StmNode;
 /**
  * @brief This is the basic node type of the Abstract Syntax Tree. The node supports linking
  * to children and parent, and defines interfaces for constant folding optimization.
+ *
+ * @details Nodes created by create() are placed in a static arena that owns them.
+ * They are never deleted one by one, the whole tree is destroyed by free_pool().
+ * Nodes constructed elsewhere (e.g. constants returned by value) are not
+ * owned by the arena. The nodes cannot be allocated with new.
  */
 class AstNode
 	: public Serializable
 {
 public:
 	using subexpression_container_t = std::vector<XprNode *>;
-	using substatement_container_t = std::vector<std::shared_ptr<StmNode>>;
+	using substatement_container_t = std::vector<StmNode *>;
+
+	/** @brief default constructor */
+	AstNode() : m_parent(nullptr) { }
 
 	/** @brief destructor providing heterogeneous data structure */
-	virtual ~AstNode();
+	virtual ~AstNode() = default;
+
+	/** @brief construct a node in the arena, the node is destroyed by free_pool() */
+	template <class T, class... Args>
+	static T *create(Args &&...args) { return m_arena.create<T>(std::forward<Args>(args)...); }
+
+	/** @brief destroy all nodes of the syntax tree (at the end of everything) */
+	static void free_pool() { m_arena.release(); }
 
 	/** @brief add a new subexpression to the node */
 	void add_subxpr(XprNode *c);
 
 	/** @brief add a new substatement to the node */
-	void add_substm(std::shared_ptr<StmNode> const &s);
+	void add_substm(StmNode *s);
 
 	/** @brief replace the i-th subexpression */
 	void set_subxpr(size_t i, XprNode *c);
@@ -73,10 +89,19 @@ public:
 	/** @brief perform constant folding optimization */
 	virtual void constant_fold();
 
+protected:
+	/** @brief nodes are freed with the arena, only the destructors of the derived nodes refer to this */
+	static void operator delete(void *) { }
+
 private:
+	/** @brief nodes are only allocated by create() */
+	static void *operator new(size_t size);
+
 	subexpression_container_t m_subxprs;
 	substatement_container_t m_substms;
 	AstNode *m_parent;
+	/** @brief the arena owning all nodes */
+	static Arena m_arena;
 };
 
 #endif
@@ -160,7 +160,7 @@ void BinaryXprNode::set_op()
 
 XprNode *BinaryXprNode::clone()
 {
-	BinaryXprNode *c = new BinaryXprNode(get_id());
+	BinaryXprNode *c = create<BinaryXprNode>(get_id());
 	c->set_op();
 	for (size_t i = 0; i < get_num_subxprs(); ++i)
 		c->set_subxpr(i, get_subxpr(i)->clone());
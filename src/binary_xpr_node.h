@@ -11,6 +11,7 @@
 #include "token.h"
 #include "xpr_node.h"
 
+#include <memory> // std::unique_ptr
 #include <utility>
 
 /** @brief class representing a binary expression */
@@ -16,7 +16,7 @@ public:
 
 	virtual XprNode *clone() override
 	{
-		XprNode *c = new CastXprNode(*this);
+		XprNode *c = create<CastXprNode>(*this);
 		for (size_t i = 0; i < get_num_subxprs(); ++i)
 			set_subxpr(i, get_subxpr(i)->clone());
 		return c;
@@ -1,19 +1,51 @@
+#include "assembler.h"
 #include "code_generator.h"
 #include "lexer.h"
 #include "parser.h"
+#include "pipe_buffer.h"
 #include "preproc.h"
+#include "symbol.h"
 #include "symbol_table.h"
 #include "type.h"
 
 #include <fstream>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** @brief Replace the extension of a file name, or append one if there is none */
+static std::string replace_extension(std::string const &name, char const *ext)
+{
+	size_t dot = name.rfind('.');
+	size_t slash = name.rfind('/');
+	if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+		return name + ext;
+	return name.substr(0, dot) + ext;
+}
 
 int main(int argc, char *argv[])
 {
 	char const *asmname = "a.s";   // name of output
 	char const *lexname = nullptr; // name of lex file
 	char const *astname = nullptr; // name of syntax tree file
-	char const *prepname = "a.prep";
+	char const *prepname = nullptr; // name of preprocessed file
+	bool print_stats = false;		// print statistics of the compilation
+	bool deps_only = false;			// print the dependencies of the input and stop after preprocessing
+	bool write_deps = false;		// write the dependencies of the input next to the output
+	bool has_output = false;		// the name of the output is given
+	bool asm_comments = true;		// annotate the assembly output with comments
+	bool peephole = true;			// optimize the generated functions with the peephole optimizer
+	bool object_output = false;		// write an object file instead of assembly
+	bool pipe_output = false;		// assemble the object by piping the assembly into the system assembler
+	bool asm_output = false;		// write assembly even if an object is requested
+	std::string objname;			// the default name of the object file
+	std::vector<std::pair<std::string, bool>> include_paths;	// the -I and -isystem directories
+	bool failed = false;			// the compilation has thrown an exception
 
 	if (argc < 2)
 	{
@@ -24,29 +56,85 @@ int main(int argc, char *argv[])
 	for (int i = 1; i < argc; ++i)
 	{
 		if (strcmp(argv[i], "-o") == 0)
+		{
 			asmname = argv[++i];
+			has_output = true;
+		}
 		else if (strcmp(argv[i], "-prep") == 0)
 			prepname = argv[++i];
 		else if (strcmp(argv[i], "-lex") == 0)
 			lexname = argv[++i];
 		else if (strcmp(argv[i], "-ast") == 0)
 			astname = argv[++i];
+		else if (strcmp(argv[i], "-stats") == 0)
+			print_stats = true;
+		else if (strcmp(argv[i], "-M") == 0)
+			deps_only = true;
+		else if (strcmp(argv[i], "-MD") == 0)
+			write_deps = true;
+		else if (strcmp(argv[i], "-I") == 0)
+			include_paths.emplace_back(argv[++i], false);
+		else if (strncmp(argv[i], "-I", 2) == 0)
+			include_paths.emplace_back(argv[i] + 2, false);
+		else if (strcmp(argv[i], "-isystem") == 0)
+			include_paths.emplace_back(argv[++i], true);
+		else if (strcmp(argv[i], "-fno-asm-comments") == 0)
+			asm_comments = false;
+		else if (strcmp(argv[i], "-fno-peephole") == 0)
+			peephole = false;
+		else if (strcmp(argv[i], "-c") == 0)
+			object_output = true;
+		else if (strcmp(argv[i], "-pipe") == 0)
+			pipe_output = true;
+		else if (strcmp(argv[i], "-S") == 0)
+			asm_output = true;
 		else
 			inputname = argv[i];
 	}
+	// -S overrides -c and -pipe wherever it is given
+	if (asm_output)
+		object_output = pipe_output = false;
+	else if (pipe_output)
+		object_output = true;
+	if (object_output && !has_output)
+	{
+		objname = replace_extension(inputname, ".o");
+		asmname = objname.c_str();
+	}
 
 	try
 	{
 		// preprocessing
 		Preprocessor prep;
-		prep.process(inputname, prepname);
+		for (auto const &path : include_paths)
+			prep.add_include_path(path.first, path.second);
+		if (deps_only)
+		{
+			// only the directives are followed, the rule names the output a compilation with the same options writes
+			prep.set_scan_only(true);
+			prep.process(inputname);
+			prep.print_dependencies(std::cout, asmname);
+			return 0;
+		}
+		prep.process(inputname);
 		std::cout << "Preprocessing complete." << std::endl;
+		if (write_deps)
+		{
+			std::ofstream fdeps(replace_extension(asmname, ".d"));
+			prep.print_dependencies(fdeps, asmname);
+		}
+		if (print_stats)
+			prep.print_statistics(std::cout);
+		if (prepname != nullptr)
+		{
+			std::ofstream fprep(prepname);
+			prep.print_text(fprep);
+			fprep.close();
+		}
 
 		// lexing
-		std::fstream fin(prepname);
 		Lexer lexer;
-		lexer.lex_input(fin);
-		fin.close();
+		lexer.lex_input(prep.get_token_list());
 		std::cout << "Lexing complete." << std::endl;
 		if (lexname != nullptr)
 		{
@@ -77,32 +165,73 @@ int main(int argc, char *argv[])
 		}
 
 		// code generation
-		std::ofstream ofs(asmname);
-		CodeGenerator code_generator(ofs);
+		// the assembly is streamed into the system assembler, which runs in parallel with the code generator
+		PipeBuffer pipe;
+		std::ofstream ofs;
+		if (pipe_output)
+		{
+			if (!pipe.open("as -o " + PipeBuffer::quote(asmname) + " -"))
+				throw "Could not start the assembler.";
+		}
+		else if (!object_output)
+			ofs.open(asmname);
+		std::ostream os(pipe_output ? static_cast<std::streambuf *>(&pipe) : ofs.rdbuf());
+		// the assembler outlives the code generator, which hands over its remaining instructions when destroyed
+		std::optional<Assembler> assembler;
+		CodeGenerator code_generator(os);
+		if (object_output && !pipe_output)
+			code_generator.set_assembler(&assembler.emplace());
+		code_generator.set_asm_comments(asm_comments && !object_output);
+		code_generator.set_peephole(peephole);
 		code_generator.generate_translation_unit(parser.get_translation_unit());
+		if (assembler)
+		{
+			// the object file is only created when the code generation has succeeded
+			ofs.open(asmname, std::ios::out | std::ios::binary);
+			assembler->flush(ofs);
+			if (!ofs)
+				throw "Could not write the object file.";
+		}
+		if (pipe_output && !pipe.close())
+			throw "The assembler failed.";
 		std::cout << "Code generation complete." << std::endl;
+		if (print_stats)
+			code_generator.print_statistics(std::cout);
 
 		// print type tree
 		std::ofstream gfs("graph.dot");
 		Type::print_pool(gfs);
 		gfs.close();
 		
-		// delete type tree
+		// delete syntax tree, type tree and interned strings
+		AstNode::free_pool();
 		Type::free_pool();
+		Symbol::free_pool();
 
 	}
 	catch (std::exception const &e)
 	{
 		std::cerr << "Exception caught: " << e.what() << std::endl;
+		failed = true;
 	}
 	catch (char const *e)
 	{
 		std::cerr << "Exception caught: " << e << std::endl;
+		failed = true;
 	}
 	catch (...)
 	{
 		std::cerr << "Unknown exception caught." << std::endl;
+		failed = true;
+	}
+
+	// the outputs of a failed compilation would be taken for up to date by make
+	if (failed && !deps_only)
+	{
+		std::remove(asmname);
+		if (write_deps)
+			std::remove(replace_extension(asmname, ".d").c_str());
 	}
 
-	return 0;
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
 }
@@ -0,0 +1,206 @@
+#include "char_scan.h"
+
+#include <cstdint>
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#define CHAR_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+constexpr std::array<unsigned char, 256> CharScan::make_classes()
+{
+	std::array<unsigned char, 256> table{};
+	table[' '] = table['\t'] = BLANK | SPACE;
+	table['\n'] = table['\v'] = table['\f'] = table['\r'] = SPACE;
+	for (int c = '0'; c <= '9'; ++c)
+		table[c] = DIGIT | XDIGIT;
+	for (int c = 'a'; c <= 'z'; ++c)
+		table[c] = table[c - 'a' + 'A'] = NONDIGIT | (c <= 'f' ? XDIGIT : 0);
+	table['_'] = NONDIGIT;
+	return table;
+}
+
+std::array<unsigned char, 256> const CharScan::m_classes = CharScan::make_classes();
+
+CharScan::Level CharScan::supported_level()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	__builtin_cpu_init();
+	if (sse2_kernels().skip_blanks != nullptr && __builtin_cpu_supports("sse2"))
+		return SSE2;
+#endif
+	return SCALAR;
+}
+
+void CharScan::set_level(Level level)
+{
+	Level supported = supported_level();
+	m_level = level < supported ? level : supported;
+	switch (m_level)
+	{
+	case SSE2:
+		m_kernels = sse2_kernels();
+		break;
+	default:
+		m_kernels = scalar_kernels();
+		break;
+	}
+}
+
+char const *CharScan::level_name(Level level)
+{
+	char const *names[] = {"scalar", "sse2"};
+	return names[level];
+}
+
+static char const *scalar_skip_blanks(char const *s)
+{
+	while (CharScan::is_blank(*s))
+		s++;
+	return s;
+}
+
+static char const *scalar_skip_identifier(char const *s)
+{
+	while (CharScan::is_identifier(*s))
+		s++;
+	return s;
+}
+
+static char const *scalar_find_comment_end(char const *s)
+{
+	while (*s != '\0' && (s[0] != '*' || s[1] != '/'))
+		s++;
+	return s;
+}
+
+static char const *scalar_find_quote_end(char const *s, char quote)
+{
+	while (*s != quote && *s != '\\' && *s != '\n' && *s != '\0')
+		s++;
+	return s;
+}
+
+static char const *scalar_find_line_special(char const *s)
+{
+	while (*s != '\n' && *s != '\0' && *s != '/' && *s != '"' && *s != '\'')
+		s++;
+	return s;
+}
+
+CharScan::Kernels CharScan::scalar_kernels()
+{
+	return Kernels{scalar_skip_blanks, scalar_skip_identifier, scalar_find_comment_end,
+				   scalar_find_quote_end, scalar_find_line_special};
+}
+
+CharScan::Level CharScan::m_level = CharScan::SCALAR;
+// constant initialized, so the scalar functions serve scans before the level is selected
+CharScan::Kernels CharScan::m_kernels = {scalar_skip_blanks, scalar_skip_identifier, scalar_find_comment_end,
+										 scalar_find_quote_end, scalar_find_line_special};
+
+// SSE2 is selected when the program starts if it is supported, but only in optimized builds:
+// without inlining the intrinsics the vector functions are slower than the scalar ones
+#ifdef __OPTIMIZE__
+static bool const char_scan_initialized = (CharScan::set_level(CharScan::SSE2), true);
+#endif
+
+#ifdef CHAR_SCAN_SSE2
+
+/**
+ * @brief Return the first character where the mask returned by match is set
+ *
+ * @details match maps a block of 16 characters to a bit mask, one bit per character.
+ * Aligned loads never cross a page boundary, so the bytes of the first and the
+ * last block outside of the text can be read safely, they are masked out or
+ * follow the terminating '\0' that stops every scan.
+ */
+template <class Match>
+__attribute__((no_sanitize_address)) static char const *sse2_scan(char const *s, Match match)
+{
+	unsigned offset = reinterpret_cast<uintptr_t>(s) & 15;
+	char const *p = s - offset;
+	unsigned mask = match(_mm_load_si128(reinterpret_cast<__m128i const *>(p))) >> offset << offset;
+	while (mask == 0)
+	{
+		p += 16;
+		mask = match(_mm_load_si128(reinterpret_cast<__m128i const *>(p)));
+	}
+	return p + __builtin_ctz(mask);
+}
+
+/** @brief Return 0xff in the bytes of v between lo and lo + n - 1 */
+static __m128i sse2_in_range(__m128i v, char lo, char n)
+{
+	// unsigned comparison of v - lo and n by flipping the sign bits
+	__m128i bias = _mm_set1_epi8(-128);
+	return _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(v, _mm_set1_epi8(lo)), bias), _mm_xor_si128(_mm_set1_epi8(n), bias));
+}
+
+static char const *sse2_skip_blanks(char const *s)
+{
+	return sse2_scan(s, [](__m128i v) {
+		__m128i blank = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+		return ~_mm_movemask_epi8(blank) & 0xffffu;
+	});
+}
+
+static char const *sse2_skip_identifier(char const *s)
+{
+	return sse2_scan(s, [](__m128i v) {
+		__m128i letter = sse2_in_range(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 26);
+		__m128i digit = sse2_in_range(v, '0', 10);
+		__m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+		return ~_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), underscore)) & 0xffffu;
+	});
+}
+
+static char const *sse2_find_comment_end(char const *s)
+{
+	while (true)
+	{
+		s = sse2_scan(s, [](__m128i v) {
+			__m128i star = _mm_cmpeq_epi8(v, _mm_set1_epi8('*'));
+			return unsigned(_mm_movemask_epi8(_mm_or_si128(star, _mm_cmpeq_epi8(v, _mm_setzero_si128()))));
+		});
+		if (*s == '\0' || s[1] == '/')
+			return s;
+		s++;
+	}
+}
+
+static char const *sse2_find_quote_end(char const *s, char quote)
+{
+	__m128i q = _mm_set1_epi8(quote);
+	return sse2_scan(s, [q](__m128i v) {
+		__m128i stop = _mm_or_si128(_mm_cmpeq_epi8(v, q), _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+		stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+		return unsigned(_mm_movemask_epi8(_mm_or_si128(stop, _mm_cmpeq_epi8(v, _mm_setzero_si128()))));
+	});
+}
+
+static char const *sse2_find_line_special(char const *s)
+{
+	return sse2_scan(s, [](__m128i v) {
+		__m128i stop = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+		stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, _mm_set1_epi8('/')));
+		stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+		stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+		return unsigned(_mm_movemask_epi8(stop));
+	});
+}
+
+CharScan::Kernels CharScan::sse2_kernels()
+{
+	return Kernels{sse2_skip_blanks, sse2_skip_identifier, sse2_find_comment_end,
+				   sse2_find_quote_end, sse2_find_line_special};
+}
+
+#else
+
+CharScan::Kernels CharScan::sse2_kernels()
+{
+	return Kernels{nullptr, nullptr, nullptr, nullptr, nullptr};
+}
+
+#endif
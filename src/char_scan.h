@@ -0,0 +1,118 @@
+/**
+ * @file char_scan.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::CharScan
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CHAR_SCAN_H_INCLUDED
+#define CHAR_SCAN_H_INCLUDED
+
+#include <array>
+
+/**
+ * @brief Character classification and scanning of long runs of source text
+ *
+ * @details Characters are classified by a table, independently of the locale.
+ * The scanning functions find the end of white space sequences, identifiers,
+ * comments and literals. They process 16 bytes at a time with SSE2 instructions
+ * in optimized builds, and one byte at a time otherwise.
+ * The scanned text must be terminated by '\0', every scan stops there.
+ */
+class CharScan
+{
+public:
+	/** @brief the instruction sets of the scanning functions */
+	enum Level
+	{
+		SCALAR,
+		SSE2
+	};
+
+	/** @brief Return the best level supported by the processor */
+	static Level supported_level();
+
+	/** @brief Return the level of the scanning functions */
+	static Level get_level() { return m_level; }
+
+	/** @brief Select the scanning functions, levels not supported by the processor fall back to lower ones */
+	static void set_level(Level level);
+
+	/** @brief Return the name of a level */
+	static char const *level_name(Level level);
+
+	/** @brief determines if a character is ' ' or '\t' */
+	static bool is_blank(char c) { return test(c, BLANK); }
+
+	/** @brief determines if a character is a white space, including new lines */
+	static bool is_space(char c) { return test(c, SPACE); }
+
+	/** @brief determines if a character is a decimal digit */
+	static bool is_digit(char c) { return test(c, DIGIT); }
+
+	/** @brief determines if a character is a hexadecimal digit */
+	static bool is_xdigit(char c) { return test(c, XDIGIT); }
+
+	/** @brief determines if a character may start an identifier */
+	static bool is_identifier_nondigit(char c) { return test(c, NONDIGIT); }
+
+	/** @brief determines if a character may continue an identifier */
+	static bool is_identifier(char c) { return test(c, NONDIGIT | DIGIT); }
+
+	/** @brief Return the first character that is not ' ' or '\t' */
+	static char const *skip_blanks(char const *s) { return m_kernels.skip_blanks(s); }
+
+	/** @brief Return the first character that cannot continue an identifier */
+	static char const *skip_identifier(char const *s) { return m_kernels.skip_identifier(s); }
+
+	/** @brief Return the first "*" + "/" sequence, or the terminating '\0' */
+	static char const *find_comment_end(char const *s) { return m_kernels.find_comment_end(s); }
+
+	/** @brief Return the first quote, backslash, new line or '\0' */
+	static char const *find_quote_end(char const *s, char quote) { return m_kernels.find_quote_end(s, quote); }
+
+	/** @brief Return the first new line, '/', '"', '\'' or '\0', the characters that matter when skipping lines */
+	static char const *find_line_special(char const *s) { return m_kernels.find_line_special(s); }
+
+	/** @brief the scanning functions of a level */
+	struct Kernels
+	{
+		char const *(*skip_blanks)(char const *s);
+		char const *(*skip_identifier)(char const *s);
+		char const *(*find_comment_end)(char const *s);
+		char const *(*find_quote_end)(char const *s, char quote);
+		char const *(*find_line_special)(char const *s);
+	};
+
+private:
+	/** @brief Return the scanning functions processing one byte at a time */
+	static Kernels scalar_kernels();
+
+	/** @brief Return the scanning functions using SSE2 instructions, nullptr members if they are not available */
+	static Kernels sse2_kernels();
+
+	/** @brief the character classes of the classification table */
+	enum Class : unsigned char
+	{
+		BLANK = 1,
+		SPACE = 2,
+		DIGIT = 4,
+		XDIGIT = 8,
+		NONDIGIT = 16
+	};
+
+	static bool test(char c, unsigned char cls) { return (m_classes[static_cast<unsigned char>(c)] & cls) != 0; }
+
+	/** @brief build the classification table */
+	static constexpr std::array<unsigned char, 256> make_classes();
+
+	/** @brief the classes of the characters */
+	static std::array<unsigned char, 256> const m_classes;
+	static Level m_level;
+	static Kernels m_kernels;
+};
+
+#endif
@@ -5,118 +5,104 @@
 
 #include <algorithm>
 
-std::string CodeGenerator::mnemonic(std::string const &name, size_t s, Register::Type type)
+Label CodeGenerator::generate_label()
+{
+	return Label(++m_label_counter, m_scope_counter);
+}
+
+void CodeGenerator::emit(Instruction instr, std::string_view comment)
 {
-	switch (type)
+	if (!instr.has_valid_sizes())
+		throw __FILE__ ": invalid size in mnemonic";
+	if (m_asm_comments && !comment.empty())
 	{
-	case Register::Type::INTEGER:
-		switch (s)
-		{
-		case 1:
-			return name + "b"; // byte
-		case 2:
-			return name + "w"; // word
-		case 4:
-			return name + "l"; // long word
-		case 8:
-			return name + "q"; // quad word
-		}
-		throw __FILE__ ": invalid size in mnemonic fuso";
-	case Register::Type::FLOATING:
-		switch (s)
-		{
-		case 4:
-			return name + "ss"; // scalar single
-		case 8:
-			return name + "sd"; // scalar double
-		}
-		throw __FILE__ ": invalid size in mnemonic fuso";
+		// the comments are kept until the code is written
+		char *text = static_cast<char *>(m_comment_arena.allocate(comment.size(), 1));
+		comment.copy(text, comment.size());
+		instr.set_comment(std::string_view(text, comment.size()));
 	}
-	throw __FILE__ ": invalid register type in mnemonic fuso";
+	m_code.push_back(instr);
 }
 
-Label CodeGenerator::generate_label()
+void CodeGenerator::emit_label(Operand const &label, std::string_view comment)
 {
-	return Label(++m_label_counter, m_scope_counter);
+	emit(Instruction(Instruction::LABEL, 0, Register::Type::INTEGER, label), comment);
+}
+
+void CodeGenerator::write_code()
+{
+	if (m_assembler != nullptr)
+		for (auto const &instr : m_code)
+			m_assembler->instruction(instr);
+	else
+		for (auto const &instr : m_code)
+			m_writer.instruction(instr);
+	m_code.clear();
+	m_comment_arena.release();
 }
 
-void CodeGenerator::print_code_line(std::string const &mnemonic, std::string const &op1, std::string const &op2, std::string const &comment) const
+Operand CodeGenerator::variable(Symbol id) const
 {
-	std::string ops = op1;
-	if (op2 != "")
-		ops += (", " + op2);
-	m_os << "\t" << std::setw(8) << std::left << mnemonic;
-	m_os << " " << std::setw(24) << std::left << ops;
-	if (comment != "")
-		m_os << " " << std::setw(8) << std::left << ("# " + comment);
-	m_os << std::endl;
+	LocalTableEntry const &entry = m_local_table.find(id);
+	if (entry.get_scope() == 0) // global
+		return Operand::symbol_rip(id);
+	return Operand::memory(Register(Register::Id::BP), -static_cast<long long>(entry.get_offset()));
 }
 
-void CodeGenerator::mov(Register const &from, Register const &to, std::string const &comment) const
+void CodeGenerator::mov(Register const &from, Register const &to, std::string_view comment)
 {
 	if (from.get_size() != to.get_size())
 		throw __FILE__ ": MOV error: Inconsistent register sizes";
-	print_code_line(mnemonic("mov", to.get_size(), to.get_type()), from.str(), to.str(), comment);
+	emit(Instruction(Instruction::MOV, to.get_size(), to.get_type(), from, to), comment);
 }
 
-void CodeGenerator::mov(long long val, Register const &to, std::string const &comment) const
+void CodeGenerator::mov(long long val, Register const &to, std::string_view comment)
 {
-	print_code_line(mnemonic("mov", to.get_size(), to.get_type()), immediate(val), to.str(), comment);
+	emit(Instruction(Instruction::MOV, to.get_size(), to.get_type(), Operand::immediate(val), to), comment);
 }
 
-void CodeGenerator::add(long long val, Register const &to, std::string const &comment) const
+void CodeGenerator::add(long long val, Register const &to, std::string_view comment)
 {
-	print_code_line(mnemonic("add", to.get_size(), to.get_type()), immediate(val), to.str(), comment);
+	emit(Instruction(Instruction::ADD, to.get_size(), to.get_type(), Operand::immediate(val), to), comment);
 }
 
-void CodeGenerator::sub(long long val, Register const &to, std::string const &comment) const
+void CodeGenerator::sub(long long val, Register const &to, std::string_view comment)
 {
-	print_code_line(mnemonic("sub", to.get_size(), to.get_type()), immediate(val), to.str(), comment);
+	emit(Instruction(Instruction::SUB, to.get_size(), to.get_type(), Operand::immediate(val), to), comment);
 }
 
-void CodeGenerator::push(Register const &reg, std::string const &comment) const
+void CodeGenerator::push(Register const &reg, std::string_view comment)
 {
 	if (reg.get_size() != 8)
 		throw __FILE__ ": Possible erronous push";
 	if (reg.get_type() == Register::Type::INTEGER)
-		print_code_line(mnemonic("push", reg.get_size()), reg.str(), "", comment);
+		emit(Instruction(Instruction::PUSH, reg.get_size(), Register::Type::INTEGER, reg), comment);
 	else
 	{
 		Register sp(Register::Id::SP);
 		sub(8, sp);
-		print_code_line(mnemonic("mov", reg.get_size(), Register::Type::FLOATING), Register(reg).str(), indirect(sp));
+		emit(Instruction(Instruction::MOV, reg.get_size(), Register::Type::FLOATING, reg, Operand::memory(sp)));
 	}
 }
 
-void CodeGenerator::pop(Register const &reg, std::string const &comment) const
+void CodeGenerator::pop(Register const &reg, std::string_view comment)
 {
 	if (reg.get_size() != 8)
 		throw __FILE__ ": Possible erronous pop";
 	if (reg.get_type() == Register::Type::INTEGER)
-		print_code_line(mnemonic("pop", reg.get_size()), reg.str(), "", comment);
+		emit(Instruction(Instruction::POP, reg.get_size(), Register::Type::INTEGER, reg), comment);
 	else
 	{
 		Register sp(Register::Id::SP);
-		print_code_line(mnemonic("mov", reg.get_size(), Register::Type::FLOATING), indirect(sp), Register(reg).str());
+		emit(Instruction(Instruction::MOV, reg.get_size(), Register::Type::FLOATING, Operand::memory(sp), reg));
 		add(8, sp);
 	}
 }
 
-void CodeGenerator::cmp(Register const &rhs_reg, Register const &lhs_reg, std::string const &comment) const
-{
-	if (lhs_reg.get_type() == Register::Type::INTEGER)
-		print_code_line(mnemonic("cmp", lhs_reg.get_size(), lhs_reg.get_type()), rhs_reg.str(), lhs_reg.str(), comment);
-	else
-		print_code_line(mnemonic("comi", lhs_reg.get_size(), lhs_reg.get_type()), rhs_reg.str(), lhs_reg.str(), comment);
-}
-
-void CodeGenerator::print_label(std::string const &label, std::string const &comment) const
+void CodeGenerator::cmp(Register const &rhs_reg, Register const &lhs_reg, std::string_view comment)
 {
-	m_os << label << ":";
-	if (comment != "")
-		m_os << "\t"
-			 << "# " << comment;
-	m_os << std::endl;
+	Instruction::Opcode opcode = lhs_reg.get_type() == Register::Type::INTEGER ? Instruction::CMP : Instruction::COMI;
+	emit(Instruction(opcode, lhs_reg.get_size(), lhs_reg.get_type(), rhs_reg, lhs_reg), comment);
 }
 
 Register CodeGenerator::int2int_cast(Register const &reg, Type const &t_from, Type const &t_to)
@@ -126,13 +112,15 @@ Register CodeGenerator::int2int_cast(Register const &reg, Type const &t_from, Ty
 
 	if (s_to > s_from) // size extension
 	{
-		std::string opcode = t_from.is_signed_integer() ? "movs" : "movz";
+		Instruction::Opcode opcode = t_from.is_signed_integer() ? Instruction::MOVS : Instruction::MOVZ;
 
 		// result register is the same as source but with different size
 		Register reg_to = reg;
 		reg_to.set_size(s_to);
-		std::string comment = "upcasting from " + reg.str() + " to " + reg_to.str();
-		print_code_line(mnemonic(mnemonic(opcode, s_from), s_to), reg.str(), reg_to.str(), comment);
+		std::string comment = m_asm_comments ? "upcasting from " + reg.str() + " to " + reg_to.str() : std::string();
+		Instruction instr(opcode, s_to, Register::Type::INTEGER, reg, reg_to);
+		instr.set_source_size(s_from);
+		emit(instr, comment);
 		return reg_to;
 	}
 	else if (s_to < s_from) // size reduction
@@ -149,10 +137,9 @@ Register CodeGenerator::int2floating_cast(Register const &reg_from, Type const &
 {
 	if (t_from == Type::int_type())
 	{
-		std::string opcode = "cvtsi2";
 		Register reg_to = m_reg_allocator.allocate(Register::Type::FLOATING);
 		reg_to.set_size(t_to.get_size_in_bytes());
-		print_code_line(mnemonic(opcode, t_to.get_size_in_bytes(), Register::Type::FLOATING), reg_from.str(), reg_to.str());
+		emit(Instruction(Instruction::CVTSI2, t_to.get_size_in_bytes(), Register::Type::FLOATING, reg_from, reg_to));
 		m_reg_allocator.release(reg_from);
 		return reg_to;
 	}
@@ -164,10 +151,9 @@ Register CodeGenerator::floating2int_cast(Register const &reg_from, Type const &
 {
 	if (t_from == Type::double_type() && t_to == Type::int_type())
 	{
-		std::string opcode = "cvtsd2si";
 		Register reg_to = m_reg_allocator.allocate(Register::Type::INTEGER);
 		reg_to.set_size(t_to.get_size_in_bytes());
-		print_code_line(opcode, reg_from.str(), reg_to.str());
+		emit(Instruction(Instruction::CVTSD2SI, 0, Register::Type::INTEGER, reg_from, reg_to));
 		m_reg_allocator.release(reg_from);
 		return reg_to;
 	}
@@ -176,7 +162,7 @@ Register CodeGenerator::floating2int_cast(Register const &reg_from, Type const &
 }
 
 CodeGenerator::CodeGenerator(std::ostream &os)
-	: m_os(os), m_label_counter(0), m_scope_counter(0)
+	: m_writer(os), m_assembler(nullptr), m_asm_comments(true), m_peephole_enabled(true), m_label_counter(0), m_scope_counter(0)
 {
 	m_reg_allocator.reset();
 
@@ -235,17 +221,18 @@ void CodeGenerator::generate_translation_unit(TransUnitNode *trans)
 		return;
 
 	// generate data segment
-	print_code_line(".data");
+	emit(Instruction(Instruction::DATA));
 
 	// generate initialized data segment
 
-	// generate string constants
-	for (auto const &s : trans->get_string_literals())
-		m_string_table.push_back(std::make_pair(s, generate_label()));
-	for (auto const &[str, lab] : m_string_table)
+	// generate string constants, they are read-only
+	emit(Instruction(Instruction::SECTION, 0, Register::Type::INTEGER, Operand::text(".rodata")));
+	for (auto str : trans->get_string_literals())
 	{
-		print_label(lab.str());
-		print_code_line(".string", "\"" + str + "\"");
+		Label lab = generate_label();
+		m_string_table.emplace(str, lab);
+		emit_label(Operand::label(lab));
+		emit(Instruction(Instruction::STRING, 0, Register::Type::INTEGER, Operand::string(str)));
 	}
 
 	// generate floating point constants
@@ -253,35 +240,36 @@ void CodeGenerator::generate_translation_unit(TransUnitNode *trans)
 		m_float_table.push_back(std::make_pair(s, generate_label()));
 	for (auto const &[d, lab] : m_float_table)
 	{
-		print_code_line(".align 8");
-		print_label(lab.str());
-		std::string comment = std::to_string(d);
+		emit(Instruction(Instruction::ALIGN, 0, Register::Type::INTEGER, Operand::number(8)));
+		emit_label(Operand::label(lab));
+		std::string comment = m_asm_comments ? std::to_string(d) : std::string();
 		for (int i = 0; i < sizeof(double) / sizeof(int); ++i)
 		{
 			int32_t i32 = *(reinterpret_cast<int32_t const *>(&d) + i);
-			print_code_line(".long", std::to_string(i32), "", i == 0 ? comment : "");
+			emit(Instruction(Instruction::LONG, 0, Register::Type::INTEGER, Operand::number(i32)), i == 0 ? comment : "");
 		}
 	}
 
 	// generate bss segment
-	print_code_line(".bss");
+	emit(Instruction(Instruction::BSS));
 	for (auto const &entry : trans->get_symbol_pointer()->get_symbols())
 	{
 		if (!entry.is_object())
 			continue;
 
-		std::string const &id = entry.get_id();
+		Symbol id = entry.get_id();
 		Type const &type = entry.get_type();
 
 		if (!entry.is_extern())
 		{
+			Operand name = Operand::symbol(id), size = Operand::number(type.get_size_in_bytes());
 			if (!entry.is_static())
-				print_code_line(".globl", id);
-			print_code_line(".align", std::to_string(type.get_alignment_in_bytes()));
-			print_code_line(".type", id, "@object");
-			print_code_line(".size", id, std::to_string(type.get_size_in_bytes()));
-			print_label(id);
-			print_code_line(".zero", std::to_string(type.get_size_in_bytes()));
+				emit(Instruction(Instruction::GLOBL, 0, Register::Type::INTEGER, name));
+			emit(Instruction(Instruction::ALIGN, 0, Register::Type::INTEGER, Operand::number(type.get_alignment_in_bytes())));
+			emit(Instruction(Instruction::TYPE, 0, Register::Type::INTEGER, name, Operand::text("@object")));
+			emit(Instruction(Instruction::SIZE, 0, Register::Type::INTEGER, name, size));
+			emit_label(name);
+			emit(Instruction(Instruction::ZERO, 0, Register::Type::INTEGER, size));
 		}
 
 		// these objects are available through their id-s
@@ -289,21 +277,27 @@ void CodeGenerator::generate_translation_unit(TransUnitNode *trans)
 	}
 
 	// generate text segment with functions
-	print_code_line(".text");
+	emit(Instruction(Instruction::TEXT));
+	write_code();
 	for (auto s : trans->get_functions())
 		generate_function(s);
+
+	// the whole file is written with a single flush, the object of the assembler is written by the caller
+	if (m_assembler == nullptr)
+		m_writer.flush();
 }
 
 void CodeGenerator::generate_function_prolog(FunctionNode *function)
 {
 	Register sp(Register::Id::SP), bp(Register::Id::BP);
 
-	print_code_line(".globl", function->get_identifier());
+	Operand name = Operand::symbol(function->get_identifier());
+	emit(Instruction(Instruction::GLOBL, 0, Register::Type::INTEGER, name));
 #ifdef _WIN32
 #else
-	print_code_line(".type", function->get_identifier(), "@function");
+	emit(Instruction(Instruction::TYPE, 0, Register::Type::INTEGER, name, Operand::text("@function")));
 #endif
-	print_label(function->get_identifier());
+	emit_label(name);
 
 	// save caller's frame pointer
 	push(bp, "save caller stack frame base");
@@ -317,12 +311,12 @@ void CodeGenerator::generate_function_prolog(FunctionNode *function)
 
 	mov(sp, bp, "establish new stack frame");
 
-	print_code_line("", "", "", "------end of function prolog");
+	emit(Instruction(Instruction::NONE), "------end of function prolog");
 }
 
 void CodeGenerator::generate_function_epilog(FunctionNode *function)
 {
-	print_code_line("", "", "", "------start of function epilog");
+	emit(Instruction(Instruction::NONE), "------start of function epilog");
 	Register sp(Register::Id::SP), bp(Register::Id::BP);
 	mov(bp, sp, "restore caller stack pointer");
 
@@ -334,7 +328,7 @@ void CodeGenerator::generate_function_epilog(FunctionNode *function)
 
 	pop(bp, "restore caller stack frame base");
 
-	print_code_line("ret", "", "", "end of FUNCTION");
+	emit(Instruction(Instruction::RET), "end of FUNCTION");
 }
 
 void CodeGenerator::generate_function(FunctionNode *function)
@@ -360,16 +354,16 @@ void CodeGenerator::generate_function(FunctionNode *function)
 	{
 		if (!it->is_object())
 			continue;
-		std::string const &parname = it->get_id();
-		std::string memname = m_local_table.lookup(parname);
+		Symbol parname = it->get_id();
+		Operand memname = variable(parname);
 		size_t siz = it->get_type().get_size_in_bytes();
 		Register reg_from;
 		if (it->get_type().is_floating())
 			reg_from = Register(m_floating_parameters[i++], siz);
 		else
 			reg_from = Register(m_integer_parameters[i++], siz);
-		std::string comment = "save " + parname + " to stack";
-		print_code_line(mnemonic("mov", reg_from.get_size()), reg_from.str(), memname, comment);
+		std::string comment = m_asm_comments ? "save " + parname.str() + " to stack" : std::string();
+		emit(Instruction(Instruction::MOV, reg_from.get_size(), reg_from.get_type(), reg_from, memname), comment);
 	}
 #else
 	size_t i_idx = 0, f_idx = 0;
@@ -377,16 +371,16 @@ void CodeGenerator::generate_function(FunctionNode *function)
 	{
 		if (!it->is_object())
 			continue;
-		std::string const &parname = it->get_id();
-		std::string memname = m_local_table.lookup(parname);
+		Symbol parname = it->get_id();
+		Operand memname = variable(parname);
 		size_t siz = it->get_type().get_size_in_bytes();
 		Register reg_from;
 		if (it->get_type().is_floating())
 			reg_from = Register(m_floating_parameters[f_idx++], siz);
 		else
 			reg_from = Register(m_integer_parameters[i_idx++], siz);
-		std::string comment = "save " + parname + " to stack";
-		print_code_line(mnemonic("mov", reg_from.get_size()), reg_from.str(), memname, comment);
+		std::string comment = m_asm_comments ? "save " + parname.str() + " to stack" : std::string();
+		emit(Instruction(Instruction::MOV, reg_from.get_size(), reg_from.get_type(), reg_from, memname), comment);
 	}
 #endif
 
@@ -396,9 +390,14 @@ void CodeGenerator::generate_function(FunctionNode *function)
 	// exit scope of parameters
 	exit_scope();
 
-	print_label(m_actual_function_return_label.str(), "return point of function");
+	emit_label(Operand::label(m_actual_function_return_label), "return point of function");
 
 	generate_function_epilog(function);
+
+	// the function is complete, it is optimized and its instructions are written in one pass
+	if (m_peephole_enabled)
+		m_peephole.optimize(m_code);
+	write_code();
 }
 
 void CodeGenerator::enter_scope(SymbolNode const *symbol_pointer)
@@ -415,7 +414,7 @@ void CodeGenerator::enter_scope(SymbolNode const *symbol_pointer)
 			continue;
 		size_t size = it->get_type().get_size_in_bytes();
 		size_t alignment = it->get_type().get_alignment_in_bytes();
-		std::string const &id = it->get_id();
+		Symbol id = it->get_id();
 		if (it->get_type().is_object())
 			m_local_table.push(m_scope_counter, id, size, alignment);
 	}
@@ -439,14 +438,14 @@ void CodeGenerator::exit_scope()
 	--m_scope_counter;
 }
 
-void CodeGenerator::generate_goto(Label const &lab) const
+void CodeGenerator::generate_goto(Label const &lab)
 {
 	Register sp(Register::Id::SP);
 	size_t before_offset = m_local_table.get_size();
 	size_t after_offset = m_local_table.get_size_at_scope(lab.get_scope());
 	if (after_offset != before_offset)
 		add(before_offset - after_offset, sp, "rewind stack before jump");
-	print_code_line("jmp", lab.str());
+	emit(Instruction(Instruction::JMP, 0, Register::Type::INTEGER, Operand::label(lab)));
 }
 
 void CodeGenerator::generate_block(CompoundNode const &block)
@@ -485,26 +484,26 @@ void CodeGenerator::goto_if_false(XprNode const *cond, Label const &label)
 		XprNode const *lhs_xpr = cond->get_subxpr(0), *rhs_xpr = cond->get_subxpr(1);
 		// remark: this choice is intentional, floating points must be compared as unsigned
 		bool is_signed = lhs_xpr->get_xpr_type().is_signed_integer();
-		std::string opcode;
+		Instruction::Opcode opcode;
 		switch (id)
 		{
 		case XprNode::Id::LESS:
-			opcode = is_signed ? "jge" : "jae";
+			opcode = is_signed ? Instruction::JGE : Instruction::JAE;
 			break;
 		case XprNode::Id::LESS_EQUAL:
-			opcode = is_signed ? "jg" : "ja";
+			opcode = is_signed ? Instruction::JG : Instruction::JA;
 			break;
 		case XprNode::Id::GREATER:
-			opcode = is_signed ? "jle" : "jbe";
+			opcode = is_signed ? Instruction::JLE : Instruction::JBE;
 			break;
 		case XprNode::Id::GREATER_EQUAL:
-			opcode = is_signed ? "jl" : "jb";
+			opcode = is_signed ? Instruction::JL : Instruction::JB;
 			break;
 		case XprNode::Id::EQUAL:
-			opcode = "jne";
+			opcode = Instruction::JNE;
 			break;
 		case XprNode::Id::NOT_EQUAL:
-			opcode = "je";
+			opcode = Instruction::JE;
 			break;
 		}
 		Register lhs_reg = generate_xpr(lhs_xpr);
@@ -512,7 +511,7 @@ void CodeGenerator::goto_if_false(XprNode const *cond, Label const &label)
 		m_reg_allocator.release(lhs_reg);
 		m_reg_allocator.release(rhs_reg);
 		cmp(rhs_reg, lhs_reg);
-		print_code_line(opcode, label.str());
+		emit(Instruction(opcode, 0, Register::Type::INTEGER, Operand::label(label)));
 	}
 	else if (id == XprNode::Id::LOGICAL_AND)
 	{
@@ -523,9 +522,9 @@ void CodeGenerator::goto_if_false(XprNode const *cond, Label const &label)
 	else
 	{
 		Register reg = generate_xpr(cond);
-		print_code_line(mnemonic("test", reg.get_size()), reg.str(), reg.str());
+		emit(Instruction(Instruction::TEST, reg.get_size(), Register::Type::INTEGER, reg, reg));
 		m_reg_allocator.release(reg);
-		print_code_line("jz", label.str());
+		emit(Instruction(Instruction::JZ, 0, Register::Type::INTEGER, Operand::label(label)));
 	}
 }
 
@@ -533,14 +532,14 @@ void CodeGenerator::generate_while(StmNode const &root)
 {
 	Label condition_label = generate_label(), done_label = generate_label();
 	enter_loop(condition_label, done_label);
-	print_label(condition_label.str(), "condition of WHILE statement");
+	emit_label(Operand::label(condition_label), "condition of WHILE statement");
 	// generate code for expression and testing code
 	goto_if_false(root.get_subxpr(0), done_label);
 	// generate code for statement
 	generate_statement(root.get_substm(0));
 	// generate loop jump codes
-	print_code_line("jmp", condition_label.str());
-	print_label(done_label.str(), "WHILE statement done");
+	emit(Instruction(Instruction::JMP, 0, Register::Type::INTEGER, Operand::label(condition_label)));
+	emit_label(Operand::label(done_label), "WHILE statement done");
 	exit_loop();
 }
 
@@ -548,12 +547,12 @@ void CodeGenerator::generate_do(StmNode const &root)
 {
 	Label start_label = generate_label(), condition_label = generate_label(), done_label = generate_label();
 	enter_loop(condition_label, done_label);
-	print_label(start_label.str(), "beginning of DO statement");
+	emit_label(Operand::label(start_label), "beginning of DO statement");
 	generate_statement(root.get_substm(0));
-	print_label(condition_label.str(), "condition of DO statement");
+	emit_label(Operand::label(condition_label), "condition of DO statement");
 	goto_if_false(root.get_subxpr(0), done_label);
-	print_code_line("jmp", start_label.str());
-	print_label(done_label.str(), "DO statement done");
+	emit(Instruction(Instruction::JMP, 0, Register::Type::INTEGER, Operand::label(start_label)));
+	emit_label(Operand::label(done_label), "DO statement done");
 	exit_loop();
 }
 
@@ -564,18 +563,18 @@ void CodeGenerator::generate_for(StmNode const &root)
 	// generate code for initialization
 	if (root.get_subxpr(0) != nullptr)
 		m_reg_allocator.release(generate_xpr(root.get_subxpr(0)));
-	print_label(condition_label.str(), "condition of FOR statement");
+	emit_label(Operand::label(condition_label), "condition of FOR statement");
 	// generate code for expression and testing code
 	goto_if_false(root.get_subxpr(1), done_label);
 	// generate code for statement
 	generate_statement(root.get_substm(0));
 	// generate code for step expression
-	print_label(step_label.str(), "step expression of FOR statement");
+	emit_label(Operand::label(step_label), "step expression of FOR statement");
 	if (root.get_subxpr(2))
 		m_reg_allocator.release(generate_xpr(root.get_subxpr(2)));
 	// generate loop jump codes
-	print_code_line("jmp", condition_label.str());
-	print_label(done_label.str(), "FOR statement done");
+	emit(Instruction(Instruction::JMP, 0, Register::Type::INTEGER, Operand::label(condition_label)));
+	emit_label(Operand::label(done_label), "FOR statement done");
 	exit_loop();
 }
 
@@ -590,11 +589,11 @@ void CodeGenerator::generate_if(StmNode const &root)
 	// generate code for else branch
 	if (has_else_branch)
 	{
-		print_code_line("jmp", done_label.str());
-		print_label(else_label.str(), "else branch of IF statement");
+		emit(Instruction(Instruction::JMP, 0, Register::Type::INTEGER, Operand::label(done_label)));
+		emit_label(Operand::label(else_label), "else branch of IF statement");
 		generate_statement(root.get_substm(1));
 	}
-	print_label(done_label.str(), "end of IF statement");
+	emit_label(Operand::label(done_label), "end of IF statement");
 }
 
 void CodeGenerator::generate_return(StmNode const &root)
@@ -711,12 +710,11 @@ Register CodeGenerator::generate_assignment(XprNode const *xpr)
 	{
 		IdentifierXprNode const *idxpr = static_cast<IdentifierXprNode const *>(lhs_xpr);
 		size_t ptr_size = Type::int_type().pointer_to().get_size_in_bytes();
-		std::string varname = idxpr->get_identifier();
-		std::string memname = m_local_table.lookup(varname);
+		Symbol varname = idxpr->get_identifier();
 		lhs_addr = m_reg_allocator.allocate(Register::Type::INTEGER);
 		lhs_addr.set_size(ptr_size);
-		std::string comment = "load address of " + varname + " into " + lhs_addr.str();
-		print_code_line(mnemonic("lea", ptr_size), memname, lhs_addr.str(), comment);
+		std::string comment = m_asm_comments ? "load address of " + varname.str() + " into " + lhs_addr.str() : std::string();
+		emit(Instruction(Instruction::LEA, ptr_size, Register::Type::INTEGER, variable(varname), lhs_addr), comment);
 	}
 	else if (lhs_xpr->get_id() == XprNode::Id::DEREFERENCE)
 		lhs_addr = generate_xpr(lhs_xpr->get_subxpr(0));
@@ -743,8 +741,8 @@ Register CodeGenerator::generate_assignment(XprNode const *xpr)
 			while (to_copy < block_size)
 				block_size /= 2;
 			tmp.set_size(block_size);
-			print_code_line(mnemonic("mov", block_size), std::to_string(offset) + indirect(rhs_reg), tmp.str());
-			print_code_line(mnemonic("mov", block_size), tmp.str(), std::to_string(offset) + indirect(lhs_addr));
+			emit(Instruction(Instruction::MOV, block_size, Register::Type::INTEGER, Operand::memory(rhs_reg, offset), tmp));
+			emit(Instruction(Instruction::MOV, block_size, Register::Type::INTEGER, tmp, Operand::memory(lhs_addr, offset)));
 			offset += block_size;
 			to_copy -= block_size;
 		}
@@ -752,8 +750,8 @@ Register CodeGenerator::generate_assignment(XprNode const *xpr)
 	}
 	else
 	{
-		std::string comment = "store " + rhs_reg.str() + " in *" + lhs_addr.str();
-		print_code_line(mnemonic("mov", result_size, rhs_reg.get_type()), rhs_reg.str(), indirect(lhs_addr), comment);
+		std::string comment = m_asm_comments ? "store " + rhs_reg.str() + " in *" + lhs_addr.str() : std::string();
+		emit(Instruction(Instruction::MOV, result_size, rhs_reg.get_type(), rhs_reg, Operand::memory(lhs_addr)), comment);
 	}
 	m_reg_allocator.release(lhs_addr);
 
@@ -773,12 +771,11 @@ Register CodeGenerator::generate_plusassignment(XprNode const *xpr)
 	{
 		IdentifierXprNode const *idxpr = static_cast<IdentifierXprNode const *>(lhs_xpr);
 		size_t ptr_size = Type::int_type().pointer_to().get_size_in_bytes();
-		std::string varname = idxpr->get_identifier();
-		std::string memname = m_local_table.lookup(varname);
+		Symbol varname = idxpr->get_identifier();
 		lhs_addr = m_reg_allocator.allocate(Register::Type::INTEGER);
 		lhs_addr.set_size(ptr_size);
-		std::string comment = "load address of " + varname + " into " + lhs_addr.str();
-		print_code_line(mnemonic("lea", ptr_size), memname, lhs_addr.str(), comment);
+		std::string comment = m_asm_comments ? "load address of " + varname.str() + " into " + lhs_addr.str() : std::string();
+		emit(Instruction(Instruction::LEA, ptr_size, Register::Type::INTEGER, variable(varname), lhs_addr), comment);
 	}
 	else if (lhs_xpr->get_id() == XprNode::Id::DEREFERENCE)
 		lhs_addr = generate_xpr(lhs_xpr->get_subxpr(0));
@@ -798,11 +795,11 @@ Register CodeGenerator::generate_plusassignment(XprNode const *xpr)
 		throw __FILE__ ": Pointer += is unimplemented yet";
 
 	// add *lhs to rhs
-	std::string comment = "add *" + lhs_addr.str() + " to " + rhs_reg.str();
-	print_code_line(mnemonic("add", result_size, rhs_reg.get_type()), indirect(lhs_addr), rhs_reg.str(), comment);
+	std::string comment = m_asm_comments ? "add *" + lhs_addr.str() + " to " + rhs_reg.str() : std::string();
+	emit(Instruction(Instruction::ADD, result_size, rhs_reg.get_type(), Operand::memory(lhs_addr), rhs_reg), comment);
 	// mov rhs to *lhs
-	comment = "mov " + rhs_reg.str() + " to *" + lhs_addr.str();
-	print_code_line(mnemonic("mov", result_size, rhs_reg.get_type()), rhs_reg.str(), indirect(lhs_addr), comment);
+	comment = m_asm_comments ? "mov " + rhs_reg.str() + " to *" + lhs_addr.str() : std::string();
+	emit(Instruction(Instruction::MOV, result_size, rhs_reg.get_type(), rhs_reg, Operand::memory(lhs_addr)), comment);
 
 	m_reg_allocator.release(lhs_addr);
 
@@ -812,41 +809,41 @@ Register CodeGenerator::generate_plusassignment(XprNode const *xpr)
 
 Register CodeGenerator::generate_identifier_rvalue(IdentifierXprNode const *xpr)
 {
-	std::string opcode;
+	Instruction::Opcode opcode;
 	size_t result_size;
 	Type const &xpr_type = xpr->get_xpr_type();
-	std::string const &idname = xpr->get_identifier();
-	std::string memname;
+	Symbol idname = xpr->get_identifier();
+	Operand memname;
 
 	if (xpr_type.is_function()) // the funcion's address needs to be evaluated
 	{
 		result_size = xpr_type.pointer_to().get_size_in_bytes();
-		opcode = "mov";
-		memname = idname + "@GOTPCREL(%rip)";
+		opcode = Instruction::MOV;
+		memname = Operand::symbol_got(idname);
 	}
 	else if (xpr_type.is_array()) // if id is array, its address (pointer) is evaluated
 	{
 		result_size = xpr_type.element_type().pointer_to().get_size_in_bytes();
-		opcode = "lea";
-		memname = m_local_table.lookup(idname);
+		opcode = Instruction::LEA;
+		memname = variable(idname);
 	}
 	else if (xpr_type.is_structure()) // if id is structure, its address (pointer) is evaluated
 	{
 		result_size = xpr_type.pointer_to().get_size_in_bytes();
-		opcode = "lea";
-		memname = m_local_table.lookup(idname);
+		opcode = Instruction::LEA;
+		memname = variable(idname);
 	}
 	else // else its value is moved to a register
 	{
 		result_size = xpr_type.get_size_in_bytes();
-		opcode = "mov";
-		memname = m_local_table.lookup(idname);
+		opcode = Instruction::MOV;
+		memname = variable(idname);
 	}
 	// allocate register to store appropriate size
 	Register reg = m_reg_allocator.allocate(xpr_type.is_floating() ? Register::Type::FLOATING : Register::Type::INTEGER);
 	reg.set_size(result_size);
-	std::string comment = "load " + idname + " to " + reg.str();
-	print_code_line(mnemonic(opcode, result_size, reg.get_type()), memname, reg.str(), comment);
+	std::string comment = m_asm_comments ? "load " + idname.str() + " to " + reg.str() : std::string();
+	emit(Instruction(opcode, result_size, reg.get_type(), memname, reg), comment);
 	return reg;
 }
 
@@ -858,9 +855,9 @@ Register CodeGenerator::generate_structure_member_address(XprNode const *str_ptr
 	Type structure_type = str_ptr_xpr->get_xpr_type();
 	if (structure_type.is_pointer())
 		structure_type = structure_type.referenced_type();
-	std::string const &fieldname = field_xpr->get_identifier();
+	Symbol fieldname = field_xpr->get_identifier();
 	size_t offset = structure_type.lookup_structure_field_offset(fieldname);
-	add(offset, addr_reg, "Apply offset of member " + fieldname);
+	add(offset, addr_reg, m_asm_comments ? "Apply offset of member " + fieldname.str() : std::string());
 	return addr_reg;
 }
 
@@ -895,14 +892,14 @@ Register CodeGenerator::generate_pointer_shift(XprNode const *lhs_xpr, XprNode c
 	{
 		// for simple sizes perform addition/subtraction by computing effective addres
 		if (!is_plus)
-			print_code_line(mnemonic("neg", rhs_size), rhs_reg.str());
-		print_code_line(mnemonic("lea", lhs_size), indirect(lhs_reg, rhs_reg, elsiz), lhs_reg.str());
+			emit(Instruction(Instruction::NEG, rhs_size, Register::Type::INTEGER, rhs_reg));
+		emit(Instruction(Instruction::LEA, lhs_size, Register::Type::INTEGER, Operand::memory(lhs_reg, rhs_reg, elsiz), lhs_reg));
 	}
 	else
 	{
 		// for other element sizes perform multiplication and addition/subtraction
-		print_code_line(mnemonic("imul", rhs_reg.get_size()), immediate(elsiz), rhs_reg.str());
-		print_code_line(mnemonic(is_plus ? "add" : "sub", lhs_reg.get_size()), rhs_reg.str(), lhs_reg.str());
+		emit(Instruction(Instruction::IMUL, rhs_reg.get_size(), Register::Type::INTEGER, Operand::immediate(elsiz), rhs_reg));
+		emit(Instruction(is_plus ? Instruction::ADD : Instruction::SUB, lhs_reg.get_size(), Register::Type::INTEGER, rhs_reg, lhs_reg));
 	}
 	m_reg_allocator.release(rhs_reg);
 
@@ -931,7 +928,7 @@ Register CodeGenerator::generate_binary_additive(XprNode const *xpr)
 	{
 		Register lhs_reg = generate_xpr(lhs_xpr);
 		Register rhs_reg = generate_xpr(rhs_xpr);
-		print_code_line(mnemonic(isplus ? "add" : "sub", lhs_size, lhs_reg.get_type()), rhs_reg.str(), lhs_reg.str());
+		emit(Instruction(isplus ? Instruction::ADD : Instruction::SUB, lhs_size, lhs_reg.get_type(), rhs_reg, lhs_reg));
 		m_reg_allocator.release(rhs_reg);
 		return lhs_reg;
 	}
@@ -947,26 +944,24 @@ Register CodeGenerator::generate_binary_additive(XprNode const *xpr)
 	{
 		Register lhs_reg = generate_xpr(lhs_xpr);
 		Register rhs_reg = generate_xpr(rhs_xpr);
-		std::string comment = "compute pointer difference in bytes";
-		print_code_line(mnemonic("sub", lhs_size), rhs_reg.str(), lhs_reg.str(), comment);
+		emit(Instruction(Instruction::SUB, lhs_size, Register::Type::INTEGER, rhs_reg, lhs_reg), "compute pointer difference in bytes");
 
 		size_t referenced_size = lhs_type.referenced_type().get_size_in_bytes();
 		if (referenced_size != 1)
 		{
-			comment = "divide difference by element size";
 			Register ax = m_reg_allocator.allocate(Register::Id::AX);
 			ax.set_size(lhs_size);
 			Register dx = m_reg_allocator.allocate(Register::Id::DX);
 			dx.set_size(lhs_size);
-			mov(lhs_reg, ax, comment);
+			mov(lhs_reg, ax, "divide difference by element size");
 			if (lhs_size == 8)
-				print_code_line("cqo");
+				emit(Instruction(Instruction::CQO));
 			else if (lhs_size == 4)
-				print_code_line("cdq");
+				emit(Instruction(Instruction::CDQ));
 			else if (lhs_size == 2)
-				print_code_line("cwd");
+				emit(Instruction(Instruction::CWD));
 			mov(referenced_size, rhs_reg);
-			print_code_line(mnemonic("idiv", lhs_size), rhs_reg.str());
+			emit(Instruction(Instruction::IDIV, lhs_size, Register::Type::INTEGER, rhs_reg));
 			mov(ax, lhs_reg);
 			m_reg_allocator.release(dx);
 			m_reg_allocator.release(ax);
@@ -1017,28 +1012,28 @@ Register CodeGenerator::generate_relational(XprNode const *xpr)
 {
 	XprNode const *lhs = xpr->get_subxpr(0), *rhs = xpr->get_subxpr(1);
 	Label true_label = generate_label(), done_label = generate_label();
-	std::string opcode;
+	Instruction::Opcode opcode;
 	// intentional, floating point must be handled as unsigned
 	bool is_signed = lhs->get_xpr_type().is_signed_integer();
 	switch (xpr->get_id())
 	{
 	case XprNode::Id::LESS:
-		opcode = is_signed ? "jl" : "jb";
+		opcode = is_signed ? Instruction::JL : Instruction::JB;
 		break;
 	case XprNode::Id::LESS_EQUAL:
-		opcode = is_signed ? "jle" : "jbe";
+		opcode = is_signed ? Instruction::JLE : Instruction::JBE;
 		break;
 	case XprNode::Id::GREATER:
-		opcode = is_signed ? "jg" : "ja";
+		opcode = is_signed ? Instruction::JG : Instruction::JA;
 		break;
 	case XprNode::Id::GREATER_EQUAL:
-		opcode = is_signed ? "jge" : "jae";
+		opcode = is_signed ? Instruction::JGE : Instruction::JAE;
 		break;
 	case XprNode::Id::EQUAL:
-		opcode = "je";
+		opcode = Instruction::JE;
 		break;
 	case XprNode::Id::NOT_EQUAL:
-		opcode = "jne";
+		opcode = Instruction::JNE;
 		break;
 	}
 	Register lhs_reg = generate_xpr(lhs);
@@ -1048,25 +1043,25 @@ Register CodeGenerator::generate_relational(XprNode const *xpr)
 	m_reg_allocator.release(rhs_reg);
 	// for floating point arguments a new register needs to be allocated
 	Register res_reg = m_reg_allocator.allocate(Register::Type::INTEGER);
-	print_code_line(opcode, true_label.str());
+	emit(Instruction(opcode, 0, Register::Type::INTEGER, Operand::label(true_label)));
 	// place 0/1 result in lreg, resized to int
 	res_reg.set_size(Type::int_type().get_size_in_bytes());
 	mov(0, res_reg);
-	print_code_line("jmp", done_label.str());
-	print_label(true_label.str());
+	emit(Instruction(Instruction::JMP, 0, Register::Type::INTEGER, Operand::label(done_label)));
+	emit_label(Operand::label(true_label));
 	mov(1, res_reg);
-	print_label(done_label.str());
+	emit_label(Operand::label(done_label));
 	return res_reg;
 }
 
-void CodeGenerator::generate_short_circuit_rec(XprNode const *xpr, XprNode::Id id, std::string const &jump_cond, Label const &lab)
+void CodeGenerator::generate_short_circuit_rec(XprNode const *xpr, XprNode::Id id, Instruction::Opcode jump_cond, Label const &lab)
 {
 	if (xpr->get_id() != id)
 	{
 		Register reg = generate_xpr(xpr);
 		size_t s = xpr->get_xpr_type().get_size_in_bytes();
-		print_code_line(mnemonic("test", s), reg.str(), reg.str());
-		print_code_line(jump_cond, lab.str());
+		emit(Instruction(Instruction::TEST, s, Register::Type::INTEGER, reg, reg));
+		emit(Instruction(jump_cond, 0, Register::Type::INTEGER, Operand::label(lab)));
 		m_reg_allocator.release(reg);
 	}
 	else
@@ -1079,22 +1074,22 @@ Register CodeGenerator::generate_logical_andor(XprNode const *xpr)
 	XprNode::Id id = xpr->get_id();
 	Label shortcut_label = generate_label(), done_label = generate_label();
 	if (id == XprNode::Id::LOGICAL_AND)
-		generate_short_circuit_rec(xpr, id, "jz", shortcut_label);
+		generate_short_circuit_rec(xpr, id, Instruction::JZ, shortcut_label);
 	else // LOGICAL_OR
-		generate_short_circuit_rec(xpr, id, "jnz", shortcut_label);
+		generate_short_circuit_rec(xpr, id, Instruction::JNZ, shortcut_label);
 	Register ret = m_reg_allocator.allocate(Register::Type::INTEGER);
 	ret.set_size(Type::int_type().get_size_in_bytes());
 	if (xpr->get_id() == XprNode::Id::LOGICAL_AND)
 		mov(1, ret);
 	else // LOGICAL_OR
 		mov(0, ret);
-	print_code_line("jmp", done_label.str());
-	print_label(shortcut_label.str());
+	emit(Instruction(Instruction::JMP, 0, Register::Type::INTEGER, Operand::label(done_label)));
+	emit_label(Operand::label(shortcut_label));
 	if (xpr->get_id() == XprNode::Id::LOGICAL_AND)
 		mov(0, ret);
 	else // LOGICAL_OR
 		mov(1, ret);
-	print_label(done_label.str());
+	emit_label(Operand::label(done_label));
 	return ret;
 }
 
@@ -1113,7 +1108,7 @@ Register CodeGenerator::generate_divmod(XprNode const *xpr)
 
 	// result will be stored in lhs
 	if (isdiv && lhs_type.is_floating())
-		print_code_line(mnemonic("div", lhs_size, lhs_reg.get_type()), rhs_reg.str(), lhs_reg.str());
+		emit(Instruction(Instruction::DIV, lhs_size, lhs_reg.get_type(), rhs_reg, lhs_reg));
 	else
 	{
 		// division is performed in ax:dx
@@ -1123,13 +1118,13 @@ Register CodeGenerator::generate_divmod(XprNode const *xpr)
 		dx.set_size(lhs_size);
 		mov(lhs_reg, ax);
 		if (lhs_size == 2)
-			print_code_line("cwd");
+			emit(Instruction(Instruction::CWD));
 		else if (lhs_size == 4)
-			print_code_line("cdq");
+			emit(Instruction(Instruction::CDQ));
 		else if (lhs_size == 8)
-			print_code_line("cqo");
-		std::string divcode = lhs_type.is_signed_integer() ? "idiv" : "div";
-		print_code_line(mnemonic(divcode, lhs_size), rhs_reg.str());
+			emit(Instruction(Instruction::CQO));
+		Instruction::Opcode divcode = lhs_type.is_signed_integer() ? Instruction::IDIV : Instruction::DIV;
+		emit(Instruction(divcode, lhs_size, Register::Type::INTEGER, rhs_reg));
 		mov(isdiv ? ax : dx, lhs_reg);
 		m_reg_allocator.release(ax);
 		m_reg_allocator.release(dx);
@@ -1147,18 +1142,18 @@ Register CodeGenerator::generate_times(XprNode const *xpr)
 	Register rhs_reg = generate_xpr(rhs_xpr);
 	// result will be stored in lhs
 	if (lhs_type.is_signed_integer())
-		print_code_line(mnemonic("imul", s), rhs_reg.str(), lhs_reg.str());
+		emit(Instruction(Instruction::IMUL, s, Register::Type::INTEGER, rhs_reg, lhs_reg));
 	else if (lhs_type.is_unsigned_integer())
 	{
 		Register ax = m_reg_allocator.allocate(Register::Id::AX);
 		ax.set_size(s);
 		mov(lhs_reg, ax);
-		print_code_line(mnemonic("mul", s), rhs_reg.str());
+		emit(Instruction(Instruction::MUL, s, Register::Type::INTEGER, rhs_reg));
 		mov(ax, lhs_reg);
 		m_reg_allocator.release(ax);
 	}
 	else if (lhs_type.is_floating())
-		print_code_line(mnemonic("mul", s, lhs_reg.get_type()), rhs_reg.str(), lhs_reg.str());
+		emit(Instruction(Instruction::MUL, s, lhs_reg.get_type(), rhs_reg, lhs_reg));
 	m_reg_allocator.release(rhs_reg);
 	return lhs_reg;
 }
@@ -1178,7 +1173,7 @@ Register CodeGenerator::generate_dereference(XprNode const *xpr)
 	// allocate register for dereferenced value
 	Register val = m_reg_allocator.allocate(referenced_type.is_floating() ? Register::Type::FLOATING : Register::Type::INTEGER);
 	val.set_size(s);
-	print_code_line(mnemonic("mov", s), indirect(addr_reg), val.str());
+	emit(Instruction(Instruction::MOV, s, val.get_type(), Operand::memory(addr_reg), val));
 	m_reg_allocator.release(addr_reg);
 	return val;
 }
@@ -1199,7 +1194,7 @@ Register CodeGenerator::generate_array_subscript_rvalue(XprNode const *xpr)
 	m_reg_allocator.release(addr_reg);
 	Register res_reg = m_reg_allocator.allocate(elem_type.is_floating() ? Register::Type::FLOATING : Register::Type::INTEGER);
 	res_reg.set_size(elem_type.get_size_in_bytes());
-	print_code_line(mnemonic("mov", res_reg.get_size(), res_reg.get_type()), indirect(addr_reg), res_reg.str());
+	emit(Instruction(Instruction::MOV, res_reg.get_size(), res_reg.get_type(), Operand::memory(addr_reg), res_reg));
 	return res_reg;
 }
 
@@ -1219,7 +1214,7 @@ Register CodeGenerator::generate_structure_member_rvalue(XprNode const *xpr)
 	m_reg_allocator.release(addr_reg);
 	Register res_reg = m_reg_allocator.allocate(field_type.is_floating() ? Register::Type::FLOATING : Register::Type::INTEGER);
 	res_reg.set_size(field_type.get_size_in_bytes());
-	print_code_line(mnemonic("mov", res_reg.get_size(), res_reg.get_type()), indirect(addr_reg), res_reg.str());
+	emit(Instruction(Instruction::MOV, res_reg.get_size(), res_reg.get_type(), Operand::memory(addr_reg), res_reg));
 	return res_reg;
 }
 
@@ -1234,16 +1229,16 @@ Register CodeGenerator::generate_conditional(XprNode const *xpr)
 
 	// generate true to reg, this will be the result register
 	Register reg = generate_xpr(tr);
-	print_code_line("jmp", done_label.str());
+	emit(Instruction(Instruction::JMP, 0, Register::Type::INTEGER, Operand::label(done_label)));
 
 	// generate false somewhere
-	print_label(false_label.str());
+	emit_label(Operand::label(false_label));
 	Register f = generate_xpr(fl);
 	m_reg_allocator.release(f);
 	// move false result to return register
 	mov(f, reg);
 
-	print_label(done_label.str());
+	emit_label(Operand::label(done_label));
 	return reg;
 }
 
@@ -1308,7 +1303,7 @@ Register CodeGenerator::generate_function_call(XprNode const *xpr)
 		{
 			m_reg_allocator.release(reg);
 			registers_to_save.push_back(reg);
-			push(reg, "Preserve value in register" + Register(reg).str());
+			push(reg, m_asm_comments ? "Preserve value in register" + Register(reg).str() : std::string());
 		}
 	}
 	size_t bytes_pushed = 8 * registers_to_save.size();
@@ -1333,14 +1328,14 @@ Register CodeGenerator::generate_function_call(XprNode const *xpr)
 		size_t r = s - 1;
 		Register xpr_reg = generate_xpr(xpr->get_subxpr(s));
 		if (param_regs[r] == Register::Id::NO_REGISTER)
-			push(xpr_reg, "Push argument #" + std::to_string(r));
+			push(xpr_reg, m_asm_comments ? "Push argument #" + std::to_string(r) : std::string());
 		else
 		{
 			// allocate register defined by calling convention
 			Register param_reg = m_reg_allocator.allocate(param_regs[r]);
 			param_reg.set_size(xpr_reg.get_size());
 			// copy value and release expression register
-			comment = "Move argument #" + std::to_string(r) + " to " + param_reg.str();
+			comment = m_asm_comments ? "Move argument #" + std::to_string(r) + " to " + param_reg.str() : std::string();
 			mov(xpr_reg, param_reg, comment);
 #ifdef _WIN32
 			if (is_vararg && param_reg.get_type() == Register::Type::FLOATING)
@@ -1364,8 +1359,7 @@ Register CodeGenerator::generate_function_call(XprNode const *xpr)
 				++num_vector_parameters;
 		Register ax = m_reg_allocator.allocate(Register::Id::AX);
 		ax.set_size(4);
-		comment = "Number of vector arguments for vararg functions";
-		mov(num_vector_parameters, ax, comment);
+		mov(num_vector_parameters, ax, "Number of vector arguments for vararg functions");
 		m_reg_allocator.release(ax);
 	}
 #endif
@@ -1375,10 +1369,20 @@ Register CodeGenerator::generate_function_call(XprNode const *xpr)
 	sub(32, sp, "shadow space");
 #endif
 
-	// function call
-	Register func_reg = generate_xpr(xpr->get_subxpr(0));
-	print_code_line(mnemonic("call", func_reg.get_size()), "*" + func_reg.str());
-	m_reg_allocator.release(func_reg);
+	// function call, functions designated by their names are called directly
+	XprNode const *callee = xpr->get_subxpr(0);
+	if (callee->get_id() == XprNode::Id::CAST && callee->get_subxpr(0)->get_id() == XprNode::Id::IDENTIFIER &&
+		callee->get_subxpr(0)->get_xpr_type().is_function())
+	{
+		Symbol name = static_cast<IdentifierXprNode const *>(callee->get_subxpr(0))->get_identifier();
+		emit(Instruction(Instruction::CALL, 8, Register::Type::INTEGER, Operand::symbol_plt(name)));
+	}
+	else
+	{
+		Register func_reg = generate_xpr(callee);
+		emit(Instruction(Instruction::CALL, func_reg.get_size(), Register::Type::INTEGER, Operand::indirect(func_reg)));
+		m_reg_allocator.release(func_reg);
+	}
 
 #ifdef _WIN32
 	// remove shadow space
@@ -1399,7 +1403,7 @@ Register CodeGenerator::generate_function_call(XprNode const *xpr)
 	for (auto it = registers_to_save.rbegin(); it != registers_to_save.rend(); ++it)
 	{
 		Register reg = Register(*it);
-		pop(reg, "Restore value in register " + reg.str());
+		pop(reg, m_asm_comments ? "Restore value in register " + reg.str() : std::string());
 		m_reg_allocator.allocate(reg.get_id());
 	}
 
@@ -1411,7 +1415,7 @@ Register CodeGenerator::generate_function_call(XprNode const *xpr)
 		ret_reg.set_size(xpr->get_xpr_type().get_size_in_bytes());
 		Register ret = m_reg_allocator.allocate(xpr->get_xpr_type().is_floating() ? Register::Type::FLOATING : Register::Type::INTEGER);
 		ret.set_size(xpr->get_xpr_type().get_size_in_bytes());
-		std::string comment = "move return value to " + ret.str();
+		std::string comment = m_asm_comments ? "move return value to " + ret.str() : std::string();
 		mov(ret_reg, ret, comment);
 		m_reg_allocator.release(ret_reg);
 		return ret; // dummy allocation for result
@@ -1430,7 +1434,7 @@ Register CodeGenerator::generate_floating_constant(FloatingConstant const &xpr)
 		{
 			Register reg = m_reg_allocator.allocate(Register::Type::FLOATING);
 			reg.set_size(xpr.get_xpr_type().get_size_in_bytes());
-			print_code_line(mnemonic("mov", reg.get_size(), reg.get_type()), lab.str() + "(%rip)", reg.str());
+			emit(Instruction(Instruction::MOV, reg.get_size(), reg.get_type(), Operand::label_rip(lab), reg));
 			return reg;
 		}
 	}
@@ -1439,18 +1443,13 @@ Register CodeGenerator::generate_floating_constant(FloatingConstant const &xpr)
 
 Register CodeGenerator::generate_string_literal(StringLiteralNode const &xpr)
 {
-	auto const &xpr_str = xpr.get_string();
-	for (auto const &[str, lab] : m_string_table)
-	{
-		if (str == xpr_str)
-		{
-			Register reg = m_reg_allocator.allocate(Register::Type::INTEGER);
-			reg.set_size(xpr.get_xpr_type().get_size_in_bytes());
-			print_code_line(mnemonic("lea", reg.get_size()), lab.str() + "(%rip)", reg.str());
-			return reg;
-		}
-	}
-	throw __FILE__ ": Did not find string literal in string table :(";
+	auto it = m_string_table.find(xpr.get_string());
+	if (it == m_string_table.end())
+		throw __FILE__ ": Did not find string literal in string table :(";
+	Register reg = m_reg_allocator.allocate(Register::Type::INTEGER);
+	reg.set_size(xpr.get_xpr_type().get_size_in_bytes());
+	emit(Instruction(Instruction::LEA, reg.get_size(), Register::Type::INTEGER, Operand::label_rip(it->second), reg));
+	return reg;
 }
 
 Register CodeGenerator::generate_unary_mp(XprNode const &xpr)
@@ -1467,13 +1466,14 @@ Register CodeGenerator::generate_unary_mp(XprNode const &xpr)
 			// we compute 0.0 - reg
 			Register result_reg = m_reg_allocator.allocate(Register::Type::FLOATING);
 			result_reg.set_size(arg_size);
-			print_code_line("pxor", result_reg.str(), result_reg.str());
-			print_code_line(mnemonic("sub", result_reg.get_size(), result_reg.get_type()), reg.str(), result_reg.str(), "floating point negate (0.0 - " + reg.str() + ")");
+			emit(Instruction(Instruction::PXOR, 0, Register::Type::INTEGER, result_reg, result_reg));
+			std::string comment = m_asm_comments ? "floating point negate (0.0 - " + reg.str() + ")" : std::string();
+			emit(Instruction(Instruction::SUB, result_reg.get_size(), result_reg.get_type(), reg, result_reg), comment);
 			m_reg_allocator.release(reg);
 			reg = result_reg;
 		}
 		else
-			print_code_line(mnemonic("neg", reg.get_size()), reg.str());
+			emit(Instruction(Instruction::NEG, reg.get_size(), Register::Type::INTEGER, reg));
 	}
 	return reg;
 }
@@ -1491,11 +1491,10 @@ Register CodeGenerator::generate_address_of(XprNode const &xpr)
 		Register reg = m_reg_allocator.allocate(Register::Type::INTEGER);
 		reg.set_size(ptr_size);
 		// lookup the memory address of the id in the local variable table
-		std::string const &varname = id_xpr->get_identifier();
-		std::string memname = m_local_table.lookup(varname);
+		Symbol varname = id_xpr->get_identifier();
 		// load effective address into register
-		std::string comment = "load  &" + varname + " to " + reg.str();
-		print_code_line(mnemonic("lea", ptr_size), memname, reg.str(), comment);
+		std::string comment = m_asm_comments ? "load  &" + varname.str() + " to " + reg.str() : std::string();
+		emit(Instruction(Instruction::LEA, ptr_size, Register::Type::INTEGER, variable(varname), reg), comment);
 		return reg;
 	}
 	else if (lvalue->get_id() == XprNode::Id::DEREFERENCE)
@@ -1514,7 +1513,8 @@ Register CodeGenerator::generate_address_of(XprNode const &xpr)
 Register CodeGenerator::generate_crement(XprNode const &xpr)
 {
 	auto child_xpr = xpr.get_subxpr(0);
-	std::string memname, comment;
+	Operand memname;
+	std::string comment;
 	Type const &result_type = child_xpr->get_xpr_type();
 	size_t result_size = result_type.get_size_in_bytes();
 	XprNode::Id op_id = xpr.get_id();
@@ -1525,9 +1525,9 @@ Register CodeGenerator::generate_crement(XprNode const &xpr)
 	if (child_xpr->get_id() == XprNode::Id::IDENTIFIER)
 	{
 		IdentifierXprNode const *id_xpr = static_cast<IdentifierXprNode const *>(child_xpr);
-		std::string varname = id_xpr->get_identifier();
-		memname = m_local_table.lookup(varname);
-		comment = (is_increment ? "++ " : "-- ") + varname;
+		Symbol varname = id_xpr->get_identifier();
+		memname = variable(varname);
+		comment = m_asm_comments ? (is_increment ? "++ " : "-- ") + varname.str() : std::string();
 	}
 	else if (child_xpr->get_id() == XprNode::Id::DEREFERENCE || child_xpr->get_id() == XprNode::Id::ARRAY_SUBSCRIPT)
 	{
@@ -1536,9 +1536,13 @@ Register CodeGenerator::generate_crement(XprNode const &xpr)
 			addr_reg = generate_xpr(child_xpr->get_subxpr(0));
 		else
 			addr_reg = generate_pointer_shift(child_xpr->get_subxpr(0), child_xpr->get_subxpr(1));
-		memname = indirect(addr_reg);
+		memname = Operand::memory(addr_reg);
 		m_reg_allocator.release(addr_reg);
-		comment = (is_increment ? "++ " : "-- ") + memname;
+		if (m_asm_comments)
+		{
+			comment = is_increment ? "++ " : "-- ";
+			memname.print(comment);
+		}
 	}
 
 	Register result_reg;
@@ -1547,23 +1551,23 @@ Register CodeGenerator::generate_crement(XprNode const &xpr)
 		// fetch result into register
 		result_reg = m_reg_allocator.allocate(Register::Type::INTEGER);
 		result_reg.set_size(result_size);
-		comment = "fetch result before in/decrement as expression value";
-		print_code_line(mnemonic("mov", result_reg.get_size()), memname, result_reg.str(), comment);
+		emit(Instruction(Instruction::MOV, result_reg.get_size(), Register::Type::INTEGER, memname, result_reg),
+			 "fetch result before in/decrement as expression value");
 	}
 
 	// perform increment / decrement
 	if (result_type.is_floating())
 		throw __FILE__ ": Floating increment is unimplemented";
 	size_t incr_size = result_type.is_pointer() ? result_type.referenced_type().get_size_in_bytes() : 1;
-	print_code_line(mnemonic(is_increment ? "add" : "sub", result_size), immediate(incr_size), memname, comment);
+	emit(Instruction(is_increment ? Instruction::ADD : Instruction::SUB, result_size, Register::Type::INTEGER, Operand::immediate(incr_size), memname), comment);
 
 	if (op_id == XprNode::Id::PREINCREMENT || op_id == XprNode::Id::PREDECREMENT)
 	{
 		// fetch result into register
 		result_reg = m_reg_allocator.allocate(Register::Type::INTEGER);
 		result_reg.set_size(result_size);
-		comment = "fetch in/decremented result as expression value";
-		print_code_line(mnemonic("mov", result_reg.get_size()), memname, result_reg.str(), comment);
+		emit(Instruction(Instruction::MOV, result_reg.get_size(), Register::Type::INTEGER, memname, result_reg),
+			 "fetch in/decremented result as expression value");
 	}
 
 	return result_reg;
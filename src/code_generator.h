@@ -11,12 +11,17 @@
 #ifndef CODE_GENERATOR_H_INCLUDED
 #define CODE_GENERATOR_H_INCLUDED
 
+#include "arena.h"
+#include "asm_writer.h"
+#include "assembler.h"
 #include "ast_node.h"
 #include "compound_node.h"
 #include "floating_constant.h"
 #include "identifier_xpr_node.h"
+#include "instruction.h"
 #include "label.h"
 #include "local_table.h"
+#include "peephole.h"
 #include "register.h"
 #include "register_allocator.h"
 #include "statement_node.h"
@@ -26,8 +31,9 @@
 #include "integer_constant.h"
 
 #include <iostream>
-#include <iomanip>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
 /**
@@ -38,35 +44,25 @@ class CodeGenerator
 public:
 	Label generate_label();
 
-	void mov(Register const &from, Register const &to, std::string const &comment = "") const;
-	void mov(long long val, Register const &to, std::string const &comment = "") const;
-	void add(long long val, Register const &to, std::string const &comment = "") const;
-	void sub(long long val, Register const &to, std::string const &comment = "") const;
-	void push(Register const &reg, std::string const &comment = "") const;
-	void pop(Register const &reg, std::string const &comment = "") const;
-	void cmp(Register const &a, Register const &b, std::string const &comment = "") const;
+	void mov(Register const &from, Register const &to, std::string_view comment = {});
+	void mov(long long val, Register const &to, std::string_view comment = {});
+	void add(long long val, Register const &to, std::string_view comment = {});
+	void sub(long long val, Register const &to, std::string_view comment = {});
+	void push(Register const &reg, std::string_view comment = {});
+	void pop(Register const &reg, std::string_view comment = {});
+	void cmp(Register const &a, Register const &b, std::string_view comment = {});
 
-	template <class T>
-	static std::string immediate(T const &num)
-	{
-		return std::string("$") + std::to_string(num);
-	}
+	/** @brief Append an instruction to the code of the current function, the comment is copied if comments are enabled */
+	void emit(Instruction instr, std::string_view comment = {});
 
-	static std::string indirect(Register const &base)
-	{
-		return "(" + base.str() + ")";
-	}
+	/** @brief Append a label definition to the code of the current function */
+	void emit_label(Operand const &label, std::string_view comment = {});
 
-	static std::string indirect(Register const &base, Register const &offset, size_t s = 1)
-	{
-		if (s == 1)
-			return "(" + base.str() + "," + offset.str() + ")";
-		else
-			return "(" + base.str() + "," + offset.str() + "," + std::to_string(s) + ")";
-	}
+	/** @brief Render the instructions collected so far as assembly text, and start a new sequence */
+	void write_code();
 
-	void print_code_line(std::string const &mnemonic = "", std::string const &op1 = "", std::string const &op2 = "", std::string const &comment = "") const;
-	void print_label(std::string const &label, std::string const &comment = "") const;
+	/** @brief Return the memory operand of a global or local variable */
+	Operand variable(Symbol id) const;
 
 	void generate_translation_unit(TransUnitNode *trans);
 
@@ -115,7 +111,7 @@ public:
 
 	Register generate_relational(XprNode const *xpr);
 
-	void generate_short_circuit_rec(XprNode const *xpr, XprNode::Id id, std::string const &jump_cond, Label const &lab);
+	void generate_short_circuit_rec(XprNode const *xpr, XprNode::Id id, Instruction::Opcode jump_cond, Label const &lab);
 
 	Register generate_logical_andor(XprNode const *xpr);
 
@@ -155,8 +151,6 @@ public:
 
 	Register generate_comma(XprNode const &xpr_node);
 
-	static std::string mnemonic(std::string const &name, size_t s, Register::Type type = Register::Type::INTEGER);
-
 	Register int2int_cast(Register const &src, Type const &from, Type const &to);
 
 	Register int2floating_cast(Register const &src, Type const &from, Type const &to);
@@ -165,19 +159,55 @@ public:
 
 	CodeGenerator(std::ostream &os = std::cout);
 
+	/** @brief Write the instructions not written yet, so that the output of a failed compilation ends where the error occurred */
+	~CodeGenerator()
+	{
+		// the compilation has failed already if the partial output cannot be written
+		try
+		{
+			write_code();
+		}
+		catch (...)
+		{
+		}
+	}
+
+	/** @brief Enable or disable the comments of the assembly output, disabled comments are not built */
+	void set_asm_comments(bool asm_comments) { m_asm_comments = asm_comments; }
+
+	/** @brief Encode the instructions with an assembler instead of writing assembly text, nullptr for text */
+	void set_assembler(Assembler *assembler) { m_assembler = assembler; }
+
+	/** @brief Enable or disable the peephole optimization of the functions */
+	void set_peephole(bool peephole) { m_peephole_enabled = peephole; }
+
+	/** @brief Print the statistics of the code generation */
+	void print_statistics(std::ostream &os) const { m_peephole.print_statistics(os); }
+
+	/** @brief Return the number of bytes of assembly generated so far */
+	size_t get_bytes_written() const { return m_writer.get_bytes_written(); }
+
 	void enter_scope(SymbolNode const *symbol_pointer);
 
 	void exit_scope();
 
-	void generate_goto(Label const &lab) const;
+	void generate_goto(Label const &lab);
 
 private:
-	std::ostream &m_os;
+	AsmWriter m_writer;
+	Assembler *m_assembler;
+	bool m_asm_comments;
+	/** @brief the instructions of the function being generated */
+	std::vector<Instruction> m_code;
+	/** @brief the comments of the instructions in m_code */
+	Arena m_comment_arena;
+	Peephole m_peephole;
+	bool m_peephole_enabled;
 	int m_label_counter;
 	int m_scope_counter;
 	RegisterAllocator m_reg_allocator;
 	LocalTable m_local_table;
-	std::vector<std::pair<std::string, Label>> m_string_table;
+	std::unordered_map<Symbol, Label> m_string_table;
 	std::vector<std::pair<double, Label>> m_float_table;
 	Label m_actual_function_return_label;
 	std::list<Label> m_continue_stack;
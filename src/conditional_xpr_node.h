@@ -12,7 +12,7 @@ public:
 
 	virtual XprNode *clone() override
 	{
-		XprNode *c = new ConditionalXprNode(*this);
+		XprNode *c = create<ConditionalXprNode>(*this);
 		for (auto x : get_subxprs())
 			c->add_subxpr(x->clone());
 		return c;
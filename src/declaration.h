@@ -7,6 +7,7 @@
 #define DECLARATION_H_INCLUDED
 
 #include "storage.h"
+#include "symbol.h"
 #include "type.h"
 
 #include <string>
@@ -24,7 +25,7 @@ public:
 	}
 
 	/** @brief constructor */
-	Declaration(Type const &t, std::string const &id = "")
+	Declaration(Type const &t, Symbol id = Symbol())
 		: m_type(t)
 		, m_identifier(id)
 		, m_is_typedef(false)
@@ -41,10 +42,10 @@ public:
 	Type const &get_type() const { return m_type; }
 
 	/** @brief set the identifier */
-	void set_identifier(std::string const &id) { m_identifier = id; }
+	void set_identifier(Symbol id) { m_identifier = id; }
 
 	/** @brief get the identifier */
-	std::string const &get_identifier() const { return m_identifier; }
+	Symbol get_identifier() const { return m_identifier; }
 
 	/** @brief set the typedef indicator */
 	void set_typedef(bool td) { m_is_typedef = td; }
@@ -77,7 +78,7 @@ public:
 	bool is_static() const { return m_storage == Storage::STATIC; }
 
 private:
-	std::string m_identifier;
+	Symbol m_identifier;
 	Type m_type;
 	bool m_is_typedef;
 	Storage m_storage;
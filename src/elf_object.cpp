@@ -0,0 +1,207 @@
+#include "elf_object.h"
+
+char const *const ElfObject::m_names[N_SECTIONS] = {".text", ".data", ".bss", ".rodata"};
+
+// SHT_PROGBITS = 1, SHT_NOBITS = 8
+unsigned const ElfObject::m_types[N_SECTIONS] = {1, 1, 8, 1};
+
+// SHF_WRITE = 1, SHF_ALLOC = 2, SHF_EXECINSTR = 4
+unsigned const ElfObject::m_flags[N_SECTIONS] = {2 | 4, 1 | 2, 1 | 2, 2};
+
+/** @brief Append a little endian value of n bytes */
+static void put(std::string &out, unsigned long long value, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		out += char(value >> 8 * i);
+}
+
+/** @brief Pad a string with zeros to a multiple of the alignment */
+static void pad(std::string &out, size_t alignment)
+{
+	out.append(-out.size() & (alignment - 1), '\0');
+}
+
+/** @brief Append a section header */
+static void put_section_header(std::string &out, size_t name, unsigned type, unsigned long long flags, size_t offset,
+							   size_t size, unsigned link, unsigned info, size_t alignment, size_t entry_size)
+{
+	put(out, name, 4);
+	put(out, type, 4);
+	put(out, flags, 8);
+	put(out, 0, 8); // address
+	put(out, offset, 8);
+	put(out, size, 8);
+	put(out, link, 4);
+	put(out, info, 4);
+	put(out, alignment, 8);
+	put(out, entry_size, 8);
+}
+
+ElfObject::ElfObject()
+{
+	for (int s = 0; s < N_SECTIONS; ++s)
+	{
+		m_sections[s].size = 0;
+		m_sections[s].alignment = 1;
+		m_symbols.push_back(SymbolEntry{std::string(), Section(s), 0, 0, STT_SECTION, false});
+	}
+}
+
+size_t ElfObject::get_size(Section section) const
+{
+	return section == BSS ? m_sections[BSS].size : m_sections[section].contents.size();
+}
+
+void ElfObject::append_zeros(Section section, size_t size)
+{
+	if (section == BSS)
+		m_sections[BSS].size += size;
+	else
+		m_sections[section].contents.append(size, '\0');
+}
+
+void ElfObject::align(Section section, size_t alignment)
+{
+	// like .align 0 of the assembler, 0 means no alignment
+	if (alignment == 0)
+		return;
+	if ((alignment & (alignment - 1)) != 0)
+		throw __FILE__ ": alignment should be a power of 2";
+	if (alignment > m_sections[section].alignment)
+		m_sections[section].alignment = alignment;
+	append_zeros(section, -get_size(section) & (alignment - 1));
+}
+
+size_t ElfObject::symbol(std::string_view name)
+{
+	auto it = m_symbol_index.find(std::string(name));
+	if (it != m_symbol_index.end())
+		return it->second;
+	m_symbols.push_back(SymbolEntry{std::string(name), N_SECTIONS, 0, 0, STT_NOTYPE, false});
+	m_symbol_index.emplace(name, m_symbols.size() - 1);
+	return m_symbols.size() - 1;
+}
+
+void ElfObject::define_symbol(size_t sym, Section section, size_t offset)
+{
+	if (m_symbols[sym].section != N_SECTIONS)
+		throw __FILE__ ": symbol defined more than once";
+	m_symbols[sym].section = section;
+	m_symbols[sym].value = offset;
+}
+
+void ElfObject::add_relocation(Section section, size_t offset, size_t sym, RelocationType type, long long addend)
+{
+	if (section == BSS)
+		throw __FILE__ ": relocation in .bss";
+	m_sections[section].relocations.push_back(Relocation{offset, sym, type, addend});
+}
+
+void ElfObject::write(std::ostream &os) const
+{
+	// local symbols precede the global ones, undefined symbols are global
+	std::vector<size_t> order, index(m_symbols.size());
+	size_t first_global = 0;
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		for (size_t i = 0; i < m_symbols.size(); ++i)
+		{
+			bool global = m_symbols[i].global || m_symbols[i].section == N_SECTIONS;
+			if (global == (pass == 1))
+			{
+				index[i] = order.size() + 1;
+				order.push_back(i);
+			}
+		}
+		if (pass == 0)
+			first_global = order.size() + 1;
+	}
+
+	std::string symtab, strtab(1, '\0');
+	symtab.append(24, '\0'); // the null symbol
+	for (size_t i : order)
+	{
+		SymbolEntry const &sym = m_symbols[i];
+		bool global = sym.global || sym.section == N_SECTIONS;
+		put(symtab, sym.name.empty() ? 0 : strtab.size(), 4);
+		if (!sym.name.empty())
+			strtab.append(sym.name).append(1, '\0');
+		put(symtab, (global ? 1 : 0) << 4 | sym.type, 1); // STB_LOCAL = 0, STB_GLOBAL = 1
+		put(symtab, 0, 1);
+		put(symtab, sym.section == N_SECTIONS ? 0 : sym.section + 1, 2);
+		put(symtab, sym.value, 8);
+		put(symtab, sym.size, 8);
+	}
+
+	// section header indices: null, contents, relocations, note, symbol table, string tables
+	std::vector<int> relocated;
+	for (int s = 0; s < N_SECTIONS; ++s)
+		if (!m_sections[s].relocations.empty())
+			relocated.push_back(s);
+	unsigned note_index = N_SECTIONS + 1 + relocated.size();
+	unsigned symtab_index = note_index + 1;
+	unsigned num_sections = symtab_index + 3;
+
+	std::string file, headers, shstrtab(1, '\0');
+	file.resize(64); // the ELF header is filled in at the end
+	put_section_header(headers, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+	for (int s = 0; s < N_SECTIONS; ++s)
+	{
+		SectionData const &sec = m_sections[s];
+		pad(file, sec.alignment);
+		put_section_header(headers, shstrtab.size(), m_types[s], m_flags[s], file.size(), get_size(Section(s)), 0, 0, sec.alignment, 0);
+		shstrtab.append(m_names[s]).append(1, '\0');
+		file += sec.contents;
+	}
+	for (int s : relocated)
+	{
+		pad(file, 8);
+		size_t offset = file.size();
+		for (auto const &rel : m_sections[s].relocations)
+		{
+			put(file, rel.offset, 8);
+			put(file, static_cast<unsigned long long>(index[rel.symbol]) << 32 | rel.type, 8);
+			put(file, rel.addend, 8);
+		}
+		// SHT_RELA = 4, SHF_INFO_LINK = 0x40
+		put_section_header(headers, shstrtab.size(), 4, 0x40, offset, file.size() - offset, symtab_index, s + 1, 8, 24);
+		shstrtab.append(".rela").append(m_names[s]).append(1, '\0');
+	}
+	// the stack of the program is not executable
+	put_section_header(headers, shstrtab.size(), 1, 0, file.size(), 0, 0, 0, 1, 0);
+	shstrtab.append(".note.GNU-stack").append(1, '\0');
+	pad(file, 8);
+	// SHT_SYMTAB = 2, SHT_STRTAB = 3
+	put_section_header(headers, shstrtab.size(), 2, 0, file.size(), symtab.size(), symtab_index + 1, first_global, 8, 24);
+	shstrtab.append(".symtab").append(1, '\0');
+	file += symtab;
+	put_section_header(headers, shstrtab.size(), 3, 0, file.size(), strtab.size(), 0, 0, 1, 0);
+	shstrtab.append(".strtab").append(1, '\0');
+	file += strtab;
+	size_t shstrtab_name = shstrtab.size();
+	shstrtab.append(".shstrtab").append(1, '\0');
+	put_section_header(headers, shstrtab_name, 3, 0, file.size(), shstrtab.size(), 0, 0, 1, 0);
+	file += shstrtab;
+	pad(file, 8);
+	size_t headers_offset = file.size();
+	file += headers;
+
+	std::string header("\x7f" "ELF\x02\x01\x01", 7); // 64 bit, little endian, version 1
+	header.append(9, '\0');
+	put(header, 1, 2);	// ET_REL
+	put(header, 62, 2); // EM_X86_64
+	put(header, 1, 4);	// version
+	put(header, 0, 8);	// entry point
+	put(header, 0, 8);	// program headers
+	put(header, headers_offset, 8);
+	put(header, 0, 4);	// flags
+	put(header, 64, 2); // size of the header
+	put(header, 0, 2);	// size and number of program headers
+	put(header, 0, 2);
+	put(header, 64, 2); // size and number of section headers
+	put(header, num_sections, 2);
+	put(header, num_sections - 1, 2); // the section names are in the last section
+	file.replace(0, 64, header);
+
+	os.write(file.data(), file.size());
+}
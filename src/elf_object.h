@@ -0,0 +1,138 @@
+/**
+ * @file elf_object.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::ElfObject
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ELF_OBJECT_H_INCLUDED
+#define ELF_OBJECT_H_INCLUDED
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief ELF64 relocatable object file for x86-64
+ *
+ * @details The object has the sections .text, .data, .bss and .rodata, a symbol
+ * table and the relocations of the sections. Symbols are referred to by the
+ * indices returned by symbol(), the sections have their own section symbols.
+ * The file is laid out by write(), locals preceding globals in the symbol table.
+ */
+class ElfObject
+{
+public:
+	/** @brief the sections of the contents */
+	enum Section
+	{
+		TEXT,
+		DATA,
+		BSS,
+		RODATA,
+		N_SECTIONS
+	};
+
+	/** @brief the types of relocations */
+	enum RelocationType
+	{
+		R_X86_64_PC32 = 2,	   ///< S + A - P
+		R_X86_64_PLT32 = 4,	   ///< L + A - P, the procedure linkage table entry of the symbol
+		R_X86_64_GOTPCREL = 9 ///< G + GOT + A - P, the global offset table entry of the symbol
+	};
+
+	/** @brief the types of symbols */
+	enum SymbolType
+	{
+		STT_NOTYPE = 0,
+		STT_OBJECT = 1,
+		STT_FUNC = 2,
+		STT_SECTION = 3
+	};
+
+	/** @brief Construct an object with empty sections */
+	ElfObject();
+
+	/** @brief Return the contents of a section, the contents of .bss are not stored */
+	std::string &contents(Section section) { return m_sections[section].contents; }
+
+	/** @brief Return the size of a section */
+	size_t get_size(Section section) const;
+
+	/** @brief Append zero bytes to a section, or increase the size of .bss */
+	void append_zeros(Section section, size_t size);
+
+	/** @brief Pad a section to a multiple of the alignment */
+	void align(Section section, size_t alignment);
+
+	/** @brief Return the index of a symbol, an undefined symbol is created at the first reference */
+	size_t symbol(std::string_view name);
+
+	/** @brief Return the index of the symbol of a section */
+	size_t section_symbol(Section section) const { return section; }
+
+	/** @brief Define a symbol at an offset of a section */
+	void define_symbol(size_t sym, Section section, size_t offset);
+
+	/** @brief Make a symbol visible to other objects */
+	void set_global(size_t sym) { m_symbols[sym].global = true; }
+
+	void set_type(size_t sym, SymbolType type) { m_symbols[sym].type = type; }
+
+	void set_size(size_t sym, size_t size) { m_symbols[sym].size = size; }
+
+	/** @brief Add a relocation of the 32 bit field at an offset of a section */
+	void add_relocation(Section section, size_t offset, size_t sym, RelocationType type, long long addend);
+
+	/** @brief Write the object file */
+	void write(std::ostream &os) const;
+
+private:
+	/** @brief entry of the symbol table */
+	struct SymbolEntry
+	{
+		std::string name;
+		/** @brief the defining section, N_SECTIONS if undefined */
+		Section section;
+		size_t value;
+		size_t size;
+		SymbolType type;
+		bool global;
+	};
+
+	/** @brief relocation entry of a section */
+	struct Relocation
+	{
+		size_t offset;
+		size_t symbol;
+		RelocationType type;
+		long long addend;
+	};
+
+	/** @brief the contents of a section */
+	struct SectionData
+	{
+		std::string contents;
+		/** @brief the size of .bss */
+		size_t size;
+		size_t alignment;
+		std::vector<Relocation> relocations;
+	};
+
+	/** @brief the names, types and flags of the sections */
+	static char const *const m_names[N_SECTIONS];
+	static unsigned const m_types[N_SECTIONS];
+	static unsigned const m_flags[N_SECTIONS];
+
+	SectionData m_sections[N_SECTIONS];
+	std::vector<SymbolEntry> m_symbols;
+	std::unordered_map<std::string, size_t> m_symbol_index;
+};
+
+#endif
@@ -0,0 +1,93 @@
+#include "file_buffer.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+bool FileBuffer::load(std::string const &fname)
+{
+	release();
+	int fd = ::open(fname.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	bool ok = ::fstat(fd, &st) == 0;
+	if (ok)
+	{
+		size_t size = st.st_size;
+		ok = (size >= map_threshold && map(fd, size)) || read(fd, size);
+	}
+	::close(fd);
+	return ok;
+}
+
+#ifdef _WIN32
+
+bool FileBuffer::map(int, size_t)
+{
+	return false;
+}
+
+#else
+
+bool FileBuffer::map(int fd, size_t size)
+{
+	// reserve one more byte of zeroed memory, and map the file over the beginning of it,
+	// the byte after the contents is zero even if the size is a multiple of the page size
+	size_t length = size + 1;
+	void *base = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED)
+		return false;
+	if (::mmap(base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+	{
+		::munmap(base, length);
+		return false;
+	}
+	m_data = static_cast<char *>(base);
+	m_size = size;
+	m_mapped = length;
+	return true;
+}
+
+#endif
+
+bool FileBuffer::read(int fd, size_t size)
+{
+	m_storage.resize(size);
+	size_t done = 0;
+	while (done < size)
+	{
+		// text mode reads may return less than the size of the file
+		auto n = ::read(fd, &m_storage[done], size - done);
+		if (n < 0)
+		{
+			release();
+			return false;
+		}
+		if (n == 0)
+			break;
+		done += n;
+	}
+	m_storage.resize(done);
+	m_data = &m_storage[0];
+	m_size = done;
+	return true;
+}
+
+void FileBuffer::release()
+{
+#ifndef _WIN32
+	if (m_mapped != 0)
+		::munmap(m_data, m_mapped);
+#endif
+	m_storage.clear();
+	m_data = &m_storage[0];
+	m_size = 0;
+	m_mapped = 0;
+}
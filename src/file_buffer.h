@@ -0,0 +1,85 @@
+/**
+ * @file file_buffer.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::FileBuffer
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef FILE_BUFFER_H_INCLUDED
+#define FILE_BUFFER_H_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief The writable, null terminated contents of a file
+ *
+ * @details Large files are mapped into memory privately, so that the
+ * pages are only copied when they are modified. Small files, and all
+ * files on systems without mmap, are read into memory at once.
+ * The contents remain at the same address until the buffer is destroyed,
+ * so views into the buffer remain valid for the lifetime of the buffer.
+ */
+class FileBuffer
+{
+public:
+	/** @brief Construct an empty buffer */
+	FileBuffer() : m_size(0), m_mapped(0) { m_data = &m_storage[0]; }
+
+	/** @brief Unmap or free the contents */
+	~FileBuffer() { release(); }
+
+	FileBuffer(FileBuffer const &other) = delete;
+
+	FileBuffer const &operator=(FileBuffer const &other) = delete;
+
+	/**
+	 * @brief Load the contents of a file, the previous contents are released
+	 *
+	 * @param fname the name of the file
+	 * @return false if the file cannot be read, the buffer is empty then
+	 */
+	bool load(std::string const &fname);
+
+	/** @brief Return the contents, the character following them is '\0' */
+	char *data() { return m_data; }
+
+	/** @brief Return the size of the contents in bytes */
+	size_t size() const { return m_size; }
+
+	/** @brief Shorten the contents to n bytes */
+	void truncate(size_t n)
+	{
+		m_size = n;
+		m_data[n] = '\0';
+	}
+
+	/** @brief Return a view of the contents */
+	std::string_view view() const { return std::string_view(m_data, m_size); }
+
+	/** @brief Indicate if the contents are mapped from the file */
+	bool is_mapped() const { return m_mapped != 0; }
+
+	/** @brief files of at least this size are mapped into memory */
+	static constexpr size_t map_threshold = 64 * 1024;
+
+private:
+	/** @brief Try mapping an open file of the given size */
+	bool map(int fd, size_t size);
+
+	/** @brief Read an open file of the given size at once */
+	bool read(int fd, size_t size);
+
+	void release();
+
+	char *m_data;
+	size_t m_size;
+	size_t m_mapped; ///< the length of the mapping, 0 if the contents were read
+	std::string m_storage; ///< the contents of files that are read
+};
+
+#endif
@@ -28,7 +28,7 @@ public:
 
 	void print(std::ostream &os, size_t level = 0) const override;
 
-	XprNode *clone() override { return new FloatingConstant(*this); }
+	XprNode *clone() override { return create<FloatingConstant>(*this); }
 
 private:
 	double m_value;
@@ -5,10 +5,10 @@
 #include "compound_node.h"
 #include "serializable.h"
 #include "statement_node.h"
+#include "symbol.h"
 #include "symbol_table_owner.h"
 
 #include <utility>
-#include <memory>
 
 class FunctionNode
 	: public Serializable
@@ -28,20 +28,18 @@ public:
 
 	void set_return_type(Type const &t) { m_return_type = t; }
 
-	std::string const &get_identifier() const { return m_identifier; }
+	Symbol get_identifier() const { return m_identifier; }
 
-	void set_identifier(std::string const &id) { m_identifier = id; }
+	void set_identifier(Symbol id) { m_identifier = id; }
 
 	CompoundNode const &get_block() const { return *m_block; }
 
-	void set_block(std::shared_ptr<CompoundNode> &&block) { m_block = std::forward<std::shared_ptr<CompoundNode>>(block); }
-
-	void set_block(std::shared_ptr<CompoundNode> const &block) { m_block = block; }
+	void set_block(CompoundNode *block) { m_block = block; }
 
 private:
 	Type m_return_type;
-	std::string m_identifier;
-	std::shared_ptr<CompoundNode> m_block;
+	Symbol m_identifier;
+	CompoundNode *m_block;
 };
 
 #endif
@@ -1,22 +1,21 @@
 #ifndef IDENTIFIER_XPR_NODE_H_INCLUDED
 #define IDENTIFIER_XPR_NODE_H_INCLUDED
 
+#include "symbol.h"
 #include "xpr_node.h"
 
-#include <string>
-
 class IdentifierXprNode : public XprNode
 {
 public:
-	IdentifierXprNode(XprNode::Id id, std::string const &identifier = "") : XprNode(id), m_identifier(identifier) { }
+	IdentifierXprNode(XprNode::Id id, Symbol identifier = Symbol()) : XprNode(id), m_identifier(identifier) { }
 
 	bool type_check_impl() override { return true;  }
 
-	XprNode *clone() override { return new IdentifierXprNode(*this); }
+	XprNode *clone() override { return create<IdentifierXprNode>(*this); }
 
-	void set_identifier(std::string const identifier) { m_identifier = identifier; }
+	void set_identifier(Symbol identifier) { m_identifier = identifier; }
 
-	std::string const &get_identifier() const { return m_identifier; }
+	Symbol get_identifier() const { return m_identifier; }
 
 	void print(std::ostream &os, size_t level = 0) const override
 	{
@@ -26,7 +25,7 @@ public:
 	}
 
 private:
-	std::string m_identifier;
+	Symbol m_identifier;
 };
 
 #endif
@@ -0,0 +1,251 @@
+#include "instruction.h"
+
+char const *const Instruction::m_names[Instruction::N_OPCODES] = {
+	"", "",
+	".data", ".bss", ".text", ".section", ".globl", ".type", ".size", ".align", ".zero", ".string", ".long",
+	"mov", "movs", "movz", "lea", "add", "sub", "imul", "mul", "idiv", "div", "neg",
+	"cmp", "comi", "test", "pxor", "cvtsi2", "cvtsd2si", "cwd", "cdq", "cqo", "push", "pop",
+	"jmp", "je", "jne", "jz", "jnz", "jl", "jle", "jg", "jge", "jb", "jbe", "ja", "jae",
+	"call", "ret"};
+
+void Operand::set_register(Kind kind, Register const &reg)
+{
+	m_kind = kind;
+	m_base = reg.get_id();
+	m_size = reg.get_size();
+}
+
+Operand Operand::indirect(Register const &reg)
+{
+	Operand op;
+	op.set_register(INDIRECT, reg);
+	return op;
+}
+
+Operand Operand::immediate(long long value)
+{
+	Operand op;
+	op.m_kind = IMMEDIATE;
+	op.m_value = value;
+	return op;
+}
+
+Operand Operand::memory(Register const &base, long long displacement)
+{
+	Operand op;
+	op.set_register(MEMORY, base);
+	op.m_value = displacement;
+	return op;
+}
+
+Operand Operand::memory(Register const &base, Register const &index, size_t scale)
+{
+	Operand op = memory(base);
+	op.m_index = index.get_id();
+	op.m_scale = scale;
+	return op;
+}
+
+Operand Operand::label(Label const &label)
+{
+	Operand op;
+	op.m_kind = LABEL;
+	op.m_value = label.get_value();
+	return op;
+}
+
+Operand Operand::symbol(Symbol name)
+{
+	Operand op;
+	op.m_kind = SYMBOL;
+	op.m_symbol = name;
+	return op;
+}
+
+Operand Operand::label_rip(Label const &label)
+{
+	Operand op = Operand::label(label);
+	op.m_kind = LABEL_RIP;
+	return op;
+}
+
+Operand Operand::symbol_rip(Symbol name)
+{
+	Operand op = symbol(name);
+	op.m_kind = SYMBOL_RIP;
+	return op;
+}
+
+Operand Operand::symbol_got(Symbol name)
+{
+	Operand op = symbol(name);
+	op.m_kind = SYMBOL_GOT;
+	return op;
+}
+
+Operand Operand::symbol_plt(Symbol name)
+{
+	Operand op = symbol(name);
+	op.m_kind = SYMBOL_PLT;
+	return op;
+}
+
+Operand Operand::number(long long value)
+{
+	Operand op = immediate(value);
+	op.m_kind = NUMBER;
+	return op;
+}
+
+Operand Operand::string(Symbol str)
+{
+	Operand op = symbol(str);
+	op.m_kind = STRING;
+	return op;
+}
+
+Operand Operand::text(char const *text)
+{
+	Operand op;
+	op.m_kind = TEXT;
+	op.m_text = text;
+	return op;
+}
+
+void Operand::print(std::string &out) const
+{
+	switch (m_kind)
+	{
+	case NONE:
+		return;
+	case INDIRECT:
+		out += '*';
+		// fall through
+	case REGISTER:
+		out += '%';
+		out += Register::name(m_base, m_size);
+		return;
+	case IMMEDIATE:
+		out += '$';
+		out += std::to_string(m_value);
+		return;
+	case MEMORY:
+		if (m_value != 0)
+			out += std::to_string(m_value);
+		out += "(%";
+		out += Register::name(m_base, 8);
+		if (m_index != Register::Id::NO_REGISTER)
+		{
+			out += ",%";
+			out += Register::name(m_index, 8);
+			if (m_scale != 1)
+			{
+				out += ',';
+				out += char('0' + m_scale);
+			}
+		}
+		out += ')';
+		return;
+	case LABEL:
+	case LABEL_RIP:
+		out += ".L";
+		out += std::to_string(m_value);
+		if (m_kind == LABEL_RIP)
+			out += "(%rip)";
+		return;
+	case SYMBOL:
+		out += m_symbol.str();
+		return;
+	case SYMBOL_RIP:
+		out += m_symbol.str();
+		out += "(%rip)";
+		return;
+	case SYMBOL_GOT:
+		out += m_symbol.str();
+		out += "@GOTPCREL(%rip)";
+		return;
+	case SYMBOL_PLT:
+		out += m_symbol.str();
+		out += "@PLT";
+		return;
+	case NUMBER:
+		out += std::to_string(m_value);
+		return;
+	case STRING:
+		out += '"';
+		out += m_symbol.str();
+		out += '"';
+		return;
+	case TEXT:
+		out += m_text;
+		return;
+	}
+}
+
+bool Operand::operator==(Operand const &other) const
+{
+	if (m_kind != other.m_kind)
+		return false;
+	switch (m_kind)
+	{
+	case NONE:
+		return true;
+	case REGISTER:
+	case INDIRECT:
+		return m_base == other.m_base && m_size == other.m_size;
+	case MEMORY:
+		return m_base == other.m_base && m_index == other.m_index && m_scale == other.m_scale && m_value == other.m_value;
+	case SYMBOL:
+	case SYMBOL_RIP:
+	case SYMBOL_GOT:
+	case SYMBOL_PLT:
+	case STRING:
+		return m_symbol == other.m_symbol;
+	case TEXT:
+		return m_text == other.m_text;
+	default:
+		return m_value == other.m_value;
+	}
+}
+
+void Instruction::print_suffix(std::string &out, size_t size) const
+{
+	if (m_type == Register::Type::FLOATING)
+	{
+		switch (size)
+		{
+		case 4:
+			out += "ss"; // scalar single
+			return;
+		case 8:
+			out += "sd"; // scalar double
+			return;
+		}
+		throw __FILE__ ": invalid size in mnemonic";
+	}
+	switch (size)
+	{
+	case 1:
+		out += 'b'; // byte
+		return;
+	case 2:
+		out += 'w'; // word
+		return;
+	case 4:
+		out += 'l'; // long word
+		return;
+	case 8:
+		out += 'q'; // quad word
+		return;
+	}
+	throw __FILE__ ": invalid size in mnemonic";
+}
+
+void Instruction::print_mnemonic(std::string &out) const
+{
+	out += m_names[m_opcode];
+	if (m_source_size != 0)
+		print_suffix(out, m_source_size);
+	if (m_size != 0)
+		print_suffix(out, m_size);
+}
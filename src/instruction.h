@@ -0,0 +1,270 @@
+/**
+ * @file instruction.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of classes ::Operand and ::Instruction
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef INSTRUCTION_H_INCLUDED
+#define INSTRUCTION_H_INCLUDED
+
+#include "label.h"
+#include "register.h"
+#include "symbol.h"
+
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Operand of a machine instruction or an assembler directive
+ *
+ * @details Operands are small values built by the factory functions.
+ * Their text is only produced when the instruction is written.
+ */
+class Operand
+{
+public:
+	/** @brief the kinds of operands */
+	enum Kind : unsigned char
+	{
+		NONE,		///< no operand
+		REGISTER,	///< %reg
+		INDIRECT,	///< *%reg, the target of an indirect call
+		IMMEDIATE,	///< $value
+		MEMORY,		///< value(%base,%index,scale), zero displacement and missing index are omitted
+		LABEL,		///< .Lvalue
+		SYMBOL,		///< name
+		LABEL_RIP,	///< .Lvalue(%rip)
+		SYMBOL_RIP, ///< name(%rip)
+		SYMBOL_GOT, ///< name@GOTPCREL(%rip)
+		SYMBOL_PLT, ///< name@PLT, the target of a direct call
+		NUMBER,		///< value, the operand of a directive
+		STRING,		///< "name", the operand of .string
+		TEXT		///< a static text, like @object
+	};
+
+	/** @brief Construct a missing operand */
+	Operand() : m_kind(NONE), m_size(0), m_scale(0), m_base(Register::Id::NO_REGISTER), m_index(Register::Id::NO_REGISTER), m_value(0), m_text(nullptr) { }
+
+	/** @brief Construct a register operand */
+	Operand(Register const &reg) : Operand() { set_register(REGISTER, reg); }
+
+	/** @brief Construct the operand of an indirect call through a register */
+	static Operand indirect(Register const &reg);
+
+	/** @brief Construct an immediate operand */
+	static Operand immediate(long long value);
+
+	/** @brief Construct a memory operand addressed by a register and a displacement */
+	static Operand memory(Register const &base, long long displacement = 0);
+
+	/** @brief Construct a memory operand addressed by a base and a scaled index register */
+	static Operand memory(Register const &base, Register const &index, size_t scale);
+
+	/** @brief Construct a label operand */
+	static Operand label(Label const &label);
+
+	/** @brief Construct a symbol operand */
+	static Operand symbol(Symbol name);
+
+	/** @brief Construct a memory operand of a label relative to the instruction pointer */
+	static Operand label_rip(Label const &label);
+
+	/** @brief Construct a memory operand of a symbol relative to the instruction pointer */
+	static Operand symbol_rip(Symbol name);
+
+	/** @brief Construct a memory operand of the global offset table entry of a symbol */
+	static Operand symbol_got(Symbol name);
+
+	/** @brief Construct the operand of a direct call of a function through the procedure linkage table */
+	static Operand symbol_plt(Symbol name);
+
+	/** @brief Construct a plain number operand of a directive */
+	static Operand number(long long value);
+
+	/** @brief Construct a string operand of a directive, the string is quoted when written */
+	static Operand string(Symbol str);
+
+	/** @brief Construct an operand of static text */
+	static Operand text(char const *text);
+
+	Kind get_kind() const { return m_kind; }
+
+	/** @brief Return the register of a register or indirect operand */
+	Register get_register() const { return Register(m_base, m_size); }
+
+	/** @brief Return the base register of a memory operand */
+	Register::Id get_base() const { return m_base; }
+
+	/** @brief Return the index register of a memory operand, NO_REGISTER if there is none */
+	Register::Id get_index() const { return m_index; }
+
+	size_t get_scale() const { return m_scale; }
+
+	/** @brief Return the immediate value, the displacement, the number or the label number */
+	long long get_value() const { return m_value; }
+
+	Symbol get_symbol() const { return m_symbol; }
+
+	char const *get_text() const { return m_text; }
+
+	/** @brief Append the AT&T text of the operand */
+	void print(std::string &out) const;
+
+	bool operator==(Operand const &other) const;
+
+	bool operator!=(Operand const &other) const { return !(*this == other); }
+
+private:
+	void set_register(Kind kind, Register const &reg);
+
+	Kind m_kind;
+	unsigned char m_size;
+	unsigned char m_scale;
+	Register::Id m_base;
+	Register::Id m_index;
+	Symbol m_symbol;
+	long long m_value;
+	char const *m_text;
+};
+
+/**
+ * @brief Machine instruction or assembler directive
+ *
+ * @details An instruction is an opcode with the operand size, the register
+ * type selecting integer or floating point mnemonics, and at most two operands
+ * in AT&T order, the source preceding the destination.
+ * Labels and comment lines are instructions too, so that a function is a
+ * sequence of instructions, rendered to text in one final pass.
+ */
+class Instruction
+{
+public:
+	/** @brief the operations */
+	enum Opcode : unsigned char
+	{
+		NONE,	///< no operation, the line of a comment
+		LABEL,	///< definition of the label of the first operand
+		// directives
+		DATA,
+		BSS,
+		TEXT,
+		SECTION,
+		GLOBL,
+		TYPE,
+		SIZE,
+		ALIGN,
+		ZERO,
+		STRING,
+		LONG,
+		// instructions
+		MOV,
+		MOVS,	///< move with sign extension from the source size
+		MOVZ,	///< move with zero extension from the source size
+		LEA,
+		ADD,
+		SUB,
+		IMUL,
+		MUL,
+		IDIV,
+		DIV,
+		NEG,
+		CMP,
+		COMI,
+		TEST,
+		PXOR,
+		CVTSI2,
+		CVTSD2SI,
+		CWD,
+		CDQ,
+		CQO,
+		PUSH,
+		POP,
+		JMP,
+		JE,
+		JNE,
+		JZ,
+		JNZ,
+		JL,
+		JLE,
+		JG,
+		JGE,
+		JB,
+		JBE,
+		JA,
+		JAE,
+		CALL,
+		RET,
+		N_OPCODES
+	};
+
+	/**
+	 * @brief Construct an instruction
+	 *
+	 * @param opcode the operation
+	 * @param size the operand size selecting the suffix of the mnemonic, 0 for no suffix
+	 * @param type integer or floating point suffixes
+	 * @param src the source or only operand
+	 * @param dst the destination operand
+	 */
+	Instruction(Opcode opcode, size_t size = 0, Register::Type type = Register::Type::INTEGER,
+				Operand const &src = Operand(), Operand const &dst = Operand())
+		: m_opcode(opcode), m_size(size), m_source_size(0), m_type(type), m_src(src), m_dst(dst)
+	{
+	}
+
+	Opcode get_opcode() const { return m_opcode; }
+
+	size_t get_size() const { return m_size; }
+
+	Register::Type get_type() const { return m_type; }
+
+	/** @brief Return the source size of a sign or zero extending move */
+	size_t get_source_size() const { return m_source_size; }
+
+	/** @brief Set the source size of a sign or zero extending move */
+	void set_source_size(size_t size) { m_source_size = size; }
+
+	Operand const &get_src() const { return m_src; }
+
+	Operand const &get_dst() const { return m_dst; }
+
+	std::string_view get_comment() const { return m_comment; }
+
+	/** @brief Set the comment of the instruction, the text must outlive the instruction */
+	void set_comment(std::string_view comment) { m_comment = comment; }
+
+	/** @brief Determine if the sizes of the instruction have mnemonic suffixes */
+	bool has_valid_sizes() const { return is_valid_size(m_source_size) && is_valid_size(m_size); }
+
+	/** @brief Append the mnemonic of the instruction, the name of the operation with the size suffixes */
+	void print_mnemonic(std::string &out) const;
+
+private:
+	/** @brief Determine if a size is 0 (no suffix) or has a suffix */
+	bool is_valid_size(size_t size) const
+	{
+		if (m_type == Register::Type::FLOATING)
+			return size == 0 || size == 4 || size == 8;
+		return size == 0 || size == 1 || size == 2 || size == 4 || size == 8;
+	}
+
+	/** @brief Append the suffix of an operand size */
+	void print_suffix(std::string &out, size_t size) const;
+
+	/** @brief the names of the operations */
+	static char const *const m_names[N_OPCODES];
+
+	Opcode m_opcode;
+	unsigned char m_size;
+	unsigned char m_source_size;
+	Register::Type m_type;
+	Operand m_src;
+	Operand m_dst;
+	std::string_view m_comment;
+};
+
+#endif
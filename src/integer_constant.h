@@ -52,7 +52,7 @@ public:
 
 	XprNode *clone() override
 	{
-		return new IntegerConstant(*this);
+		return create<IntegerConstant>(*this);
 	}
 
 	IntegerConstant operator+(IntegerConstant const &rhs) const
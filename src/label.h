@@ -13,6 +13,8 @@ public:
 
 	int get_scope() const { return m_scope; }
 
+	int get_value() const { return m_value; }
+
 private:
 	int m_value;
 	int m_scope;
@@ -1,6 +1,8 @@
 #include "lexer.h"
+#include "char_scan.h"
 
 #include <cstring>
+#include <sstream>
 #include <string>
 
 char const *Lexer::lex_floating_constant(char const *str, Token *token)
@@ -8,14 +10,14 @@ char const *Lexer::lex_floating_constant(char const *str, Token *token)
 	// floating constant
 	char const *end = str;
 	bool wasdot = false;
-	while (isdigit(*end))
+	while (CharScan::is_digit(*end))
 		end++;
 	if (*end == '.')
 	{
 		wasdot = true;
 		end++;
 	}
-	while (isdigit(*end))
+	while (CharScan::is_digit(*end))
 		end++;
 	if (wasdot)
 	{
@@ -25,7 +27,7 @@ char const *Lexer::lex_floating_constant(char const *str, Token *token)
 		if (ndigits == flc.size())
 		{
 			*token = Token(Token::Id::FLOATING_CONSTANT);
-			token->set_string(std::string(str, end));
+			token->set_string(std::string_view(str, end - str));
 			token->set_double_constant(b);
 			return end;
 		}
@@ -38,11 +40,11 @@ char const *Lexer::lex_decimal_integer_constant(char const *str, Token *token)
 	// integer constant
 	long long c = 0;
 	char const *end = str;
-	while (isdigit(*end))
+	while (CharScan::is_digit(*end))
 		c = 10 * c + *end++ - '0';
 	*token = Token(Token::Id::INTEGER_CONSTANT);
 	token->set_int_constant(c);
-	token->set_string(std::string(str, end));
+	token->set_string(std::string_view(str, end - str));
 	return end;
 }
 
@@ -57,7 +59,7 @@ char const *Lexer::lex_octal_integer_constant(char const *str, Token *token)
 	}
 	*token = Token(Token::Id::INTEGER_CONSTANT);
 	token->set_int_constant(c);
-	token->set_string(std::string(str, end));
+	token->set_string(std::string_view(str, end - str));
 	return end;
 }
 
@@ -65,7 +67,7 @@ char const *Lexer::lex_hexadecimal_integer_constant(char const *str, Token *toke
 {
 	long long c = 0;
 	char const *end = str + 2; // skip 0x prefix
-	while (isxdigit(*end))
+	while (CharScan::is_xdigit(*end))
 	{
 		c *= 16;
 		if (*end >= '0' && *end <= '9')
@@ -78,14 +80,14 @@ char const *Lexer::lex_hexadecimal_integer_constant(char const *str, Token *toke
 	}
 	*token = Token(Token::Id::INTEGER_CONSTANT);
 	token->set_int_constant(c);
-	token->set_string(std::string(str, end));
+	token->set_string(std::string_view(str, end - str));
 	return end;
 }
 
 char const *Lexer::lex_integer_constant(char const *str, Token *token)
 {
 	// integer constant
-	if (!isdigit(*str))
+	if (!CharScan::is_digit(*str))
 		return str;
 	if (*str != '0')
 		return lex_decimal_integer_constant(str, token);
@@ -102,19 +104,18 @@ char const *Lexer::lex_string_literal(char const *str, Token *token)
 	// string literal
 	if (*end == '\"')
 	{
-		end++;
-		while (*end != '\0' && *end != '\"')
+		end = CharScan::find_quote_end(end + 1, '"');
+		while (*end != '"')
 		{
-			end++;
-			if (*end == '\\' && *(end + 1) == '\"')
-				end += 2;
+			if (*end == '\0' || *end == '\n')
+				return str; // unterminated
+			if (end[1] != '\0' && end[1] != '\n')
+				end++; // skip escaped character
+			end = CharScan::find_quote_end(end + 1, '"');
 		}
-		if (*end == '\0')
-			return str;
 		end++;
-		std::string data(str + 1, end - 1);
 		*token = Token(Token::Id::STRING_LITERAL);
-		token->set_string(data);
+		token->set_string(std::string_view(str + 1, end - str - 2)); // strip quotes
 		return end;
 	}
 	return str;
@@ -126,85 +127,166 @@ char const *Lexer::lex_character_constant(char const *str, Token *token)
 	if (*end == '\'')
 	{
 		end++;
-		while (*end != '\0' && *end != '\'')
+		while (*end != '\'')
 		{
+			if (*end == '\0' || *end == '\n')
+				return str; // unterminated
+			if (*end == '\\' && end[1] != '\0' && end[1] != '\n')
+				end++; // skip escaped character
 			end++;
-			if (*end == '\\' && *(end + 1) == '\'')
-				end += 2;
 		}
-		if (*end == '\0')
-			return str;
 		end++;
-		std::string data(str, end);
 		*token = Token(Token::Id::CHARACTER_CONSTANT);
-		token->set_string(data);
+		token->set_string(std::string_view(str, end - str));
 		return end;
 	}
 	return str;
 }
 
-char const *Lexer::read_next_token(char const *str, Token *token)
+Token::Id Lexer::keyword_or_identifier(char const *str, char const *keywrd, size_t n, Token::Id t)
 {
-	while (*str != '\0' && isspace(*str))
-		str++;
-	if (*str == '\0')
-		return nullptr;
+	return memcmp(str, keywrd, n) == 0 ? t : Token::Id::IDENTIFIER;
+}
 
-	// try to read keywords
-	struct
-	{
-		Token::Id t;
-		char const *keywrd;
-	} keywords[] = {
-		{Token::Id::AUTO, "auto"},
-		{Token::Id::BREAK, "break"},
-		{Token::Id::CASE, "case"},
-		{Token::Id::CHAR, "char"},
-		{Token::Id::CONST, "const"},
-		{Token::Id::CONTINUE, "continue"},
-		{Token::Id::DEFAULT, "default"},
-		{Token::Id::DO, "do"},
-		{Token::Id::DOUBLE, "double"},
-		{Token::Id::ELSE, "else"},
-		{Token::Id::ENUM, "enum"},
-		{Token::Id::EXTERN, "extern"},
-		{Token::Id::FLOAT, "float"},
-		{Token::Id::FOR, "for"},
-		{Token::Id::GOTO, "goto"},
-		{Token::Id::IF, "if"},
-		{Token::Id::INT, "int"},
-		{Token::Id::LONG, "long"},
-		{Token::Id::RESTRICT, "restrict"},
-		{Token::Id::RETURN, "return"},
-		{Token::Id::SHORT, "short"},
-		{Token::Id::SIGNED, "signed"},
-		{Token::Id::SIZEOF, "sizeof"},
-		{Token::Id::STATIC, "static"},
-		{Token::Id::STRUCT, "struct"},
-		{Token::Id::SWITCH, "switch"},
-		{Token::Id::TYPEDEF, "typedef"},
-		{Token::Id::UNION, "union"},
-		{Token::Id::UNSIGNED, "unsigned"},
-		{Token::Id::VOID, "void"},
-		{Token::Id::WHILE, "while"},
-		{Token::Id::NO_TOKEN, nullptr}};
-	for (int i = 0; keywords[i].keywrd != nullptr; i++)
+Token::Id Lexer::classify_identifier(char const *str, size_t n)
+{
+	// the length and the first character select at most one candidate keyword,
+	// except for a few collisions that are resolved by the next character
+	switch (n)
 	{
-		auto n = strlen(keywords[i].keywrd);
-		if (strncmp(str, keywords[i].keywrd, n) == 0 && (str + n) != nullptr && !isalnum(str[n]) && str[n] != '_')
+	case 2:
+		switch (str[0])
 		{
-			*token = Token(keywords[i].t);
-			token->set_string(std::string(str, str + n));
-			return str + n;
+		case 'd':
+			return keyword_or_identifier(str, "do", n, Token::Id::DO);
+		case 'i':
+			return keyword_or_identifier(str, "if", n, Token::Id::IF);
+		}
+		break;
+	case 3:
+		switch (str[0])
+		{
+		case 'f':
+			return keyword_or_identifier(str, "for", n, Token::Id::FOR);
+		case 'i':
+			return keyword_or_identifier(str, "int", n, Token::Id::INT);
+		}
+		break;
+	case 4:
+		switch (str[0])
+		{
+		case 'a':
+			return keyword_or_identifier(str, "auto", n, Token::Id::AUTO);
+		case 'c':
+			if (str[1] == 'a')
+				return keyword_or_identifier(str, "case", n, Token::Id::CASE);
+			return keyword_or_identifier(str, "char", n, Token::Id::CHAR);
+		case 'e':
+			if (str[1] == 'l')
+				return keyword_or_identifier(str, "else", n, Token::Id::ELSE);
+			return keyword_or_identifier(str, "enum", n, Token::Id::ENUM);
+		case 'g':
+			return keyword_or_identifier(str, "goto", n, Token::Id::GOTO);
+		case 'l':
+			return keyword_or_identifier(str, "long", n, Token::Id::LONG);
+		case 'v':
+			return keyword_or_identifier(str, "void", n, Token::Id::VOID);
+		}
+		break;
+	case 5:
+		switch (str[0])
+		{
+		case 'b':
+			return keyword_or_identifier(str, "break", n, Token::Id::BREAK);
+		case 'c':
+			return keyword_or_identifier(str, "const", n, Token::Id::CONST);
+		case 'f':
+			return keyword_or_identifier(str, "float", n, Token::Id::FLOAT);
+		case 's':
+			return keyword_or_identifier(str, "short", n, Token::Id::SHORT);
+		case 'u':
+			return keyword_or_identifier(str, "union", n, Token::Id::UNION);
+		case 'w':
+			return keyword_or_identifier(str, "while", n, Token::Id::WHILE);
+		}
+		break;
+	case 6:
+		switch (str[0])
+		{
+		case 'd':
+			return keyword_or_identifier(str, "double", n, Token::Id::DOUBLE);
+		case 'e':
+			return keyword_or_identifier(str, "extern", n, Token::Id::EXTERN);
+		case 'r':
+			return keyword_or_identifier(str, "return", n, Token::Id::RETURN);
+		case 's':
+			switch (str[2])
+			{
+			case 'g':
+				return keyword_or_identifier(str, "signed", n, Token::Id::SIGNED);
+			case 'z':
+				return keyword_or_identifier(str, "sizeof", n, Token::Id::SIZEOF);
+			case 'a':
+				return keyword_or_identifier(str, "static", n, Token::Id::STATIC);
+			case 'r':
+				return keyword_or_identifier(str, "struct", n, Token::Id::STRUCT);
+			case 'i':
+				return keyword_or_identifier(str, "switch", n, Token::Id::SWITCH);
+			}
+			break;
+		}
+		break;
+	case 7:
+		switch (str[0])
+		{
+		case 'd':
+			return keyword_or_identifier(str, "default", n, Token::Id::DEFAULT);
+		case 't':
+			return keyword_or_identifier(str, "typedef", n, Token::Id::TYPEDEF);
 		}
+		break;
+	case 8:
+		switch (str[0])
+		{
+		case 'c':
+			return keyword_or_identifier(str, "continue", n, Token::Id::CONTINUE);
+		case 'r':
+			return keyword_or_identifier(str, "restrict", n, Token::Id::RESTRICT);
+		case 'u':
+			return keyword_or_identifier(str, "unsigned", n, Token::Id::UNSIGNED);
+		}
+		break;
 	}
+	return Token::Id::IDENTIFIER;
+}
 
-	// try to read operators
-	struct
+char const *Lexer::lex_identifier(char const *str, Token *token)
+{
+	char const *end = str;
+	if (!CharScan::is_identifier_nondigit(*end))
+		return str;
+	end = CharScan::skip_identifier(end + 1);
+	*token = identifier_token(str, end - str);
+	return end;
+}
+
+Token Lexer::identifier_token(char const *str, size_t n)
+{
+	std::string_view spelling(str, n);
+	Token token(classify_identifier(str, n));
+	token.set_string(spelling);
+	if (token.get_id() == Token::Id::IDENTIFIER)
+		token.set_symbol(Symbol(spelling));
+	return token;
+}
+
+char const *Lexer::lex_operator(char const *str, Token *token)
+{
+	static struct
 	{
 		Token::Id t;
 		char const *op;
-	} ops[] = {
+	} const ops[] = {
 		{Token::Id::ELLIPSIS, "..."},
 		{Token::Id::SHR_ASSIGN, ">>="},
 		{Token::Id::SHL_ASSIGN, "<<="},
@@ -258,22 +340,29 @@ char const *Lexer::read_next_token(char const *str, Token *token)
 		if (strncmp(str, ops[i].op, n) == 0)
 		{
 			*token = Token(ops[i].t);
-			token->set_string(std::string(str, str + n));
+			token->set_string(std::string_view(str, n));
 			return str + n;
 		}
 	}
+	return str;
+}
 
-	// try to read an identifier
-	char const *end = str;
-	if (isalpha(*end) || *end == '_')
-	{
-		end++;
-		while (*end != '\0' && (isalnum(*end) || *end == '_'))
-			end++;
-		*token = Token(Token::Id::IDENTIFIER);
-		token->set_string(std::string(str, end));
+char const *Lexer::read_next_token(char const *str, Token *token)
+{
+	while (CharScan::is_space(*str))
+		str++;
+	if (*str == '\0')
+		return nullptr;
+
+	// try to read an identifier or a keyword
+	char const *end = lex_identifier(str, token);
+	if (end != str)
+		return end;
+
+	// try to read operators
+	end = lex_operator(str, token);
+	if (end != str)
 		return end;
-	}
 
 	// try to read floating constant
 	end = lex_floating_constant(str, token);
@@ -299,32 +388,110 @@ char const *Lexer::read_next_token(char const *str, Token *token)
 	return str;
 }
 
-void Lexer::lex_input(std::istream &is)
+bool Lexer::lex_text(char const *str, size_t line, size_t col)
 {
-	enum
+	char const *ptr = str;
+	char const *line_begin = str - (col - 1);
+	char const *end;
+	Token token;
+	while (true)
 	{
-		MAX_LINE = 1024
-	};
-	char linebuf[MAX_LINE];
-	size_t line_cntr = 0;
+		// skip white spaces and count new lines, the coordinate is the first character of the token
+		while (CharScan::is_space(*ptr))
+			if (*ptr++ == '\n')
+			{
+				line++;
+				line_begin = ptr;
+			}
+		if ((end = read_next_token(ptr, &token)) == nullptr)
+			return true;
+		if (end == ptr)
+		{
+			char const *eol = ptr;
+			while (*eol != '\0' && *eol != '\n')
+				eol++;
+			std::cerr << "Lexing error at line " << line << ". Could not interpret " << std::string(ptr, eol) << std::endl;
+			return false;
+		}
+		token.set_coordinate(Coordinate(line, ptr - line_begin + 1));
+		m_token_list.push_back(token);
+		ptr = end;
+	}
+}
+
+void Lexer::lex_input(std::istream &is)
+{
+	// read the whole input at once, lines are tracked by the scanner
+	std::ostringstream buffer;
+	buffer << is.rdbuf();
+	m_text = buffer.str(); // the tokens refer into this buffer
+	m_token_list.clear();
+	lex_text(m_text.c_str(), 1, 1);
+}
 
-	while (is.getline(linebuf, MAX_LINE))
+void Lexer::lex_input(std::vector<PreprocToken> const &pp_tokens)
+{
+	// the token texts are copied into one buffer, each of them null terminated,
+	// the buffer is reserved in advance, so that the tokens' views remain valid
+	size_t text_size = 0, ntokens = 0;
+	for (auto const &pt : pp_tokens)
+		if (pt.get_category() != PreprocToken::NEW_LINE && !pt.is_white_space())
+		{
+			text_size += pt.get_string().size() + 1;
+			ntokens++;
+		}
+	m_text.clear();
+	m_text.reserve(text_size);
+	m_token_list.clear();
+	m_token_list.reserve(ntokens);
+
+	for (auto const &pt : pp_tokens)
 	{
-		char const *ptr = linebuf;
-		char const *end;
-		line_cntr++;
+		size_t size = pt.get_string().size();
+		if (pt.get_category() == PreprocToken::NEW_LINE || pt.is_white_space())
+			continue;
+		// coordinates refer to the physical lines of the source files
+		size_t line = pt.get_coordinate().get_line();
+		size_t col = pt.get_coordinate().get_col();
+
+		char const *ptr = m_text.c_str() + m_text.size();
+		m_text.append(pt.get_string());
+		m_text.push_back('\0');
+		char const *end = ptr + size;
 		Token token;
-		while ((end = read_next_token(ptr, &token)) != nullptr)
+		switch (pt.get_category())
 		{
-			if (end == ptr)
-			{
-				std::cerr << "Lexing error at line " << line_cntr << ". Could not interpret " << ptr << std::endl;
+		case PreprocToken::IDENTIFIER:
+			token = identifier_token(ptr, size);
+			break;
+		case PreprocToken::PUNCTUATOR:
+			end = lex_operator(ptr, &token);
+			break;
+		case PreprocToken::PP_NUMBER:
+			if ((end = lex_floating_constant(ptr, &token)) == ptr)
+				end = lex_integer_constant(ptr, &token);
+			break;
+		case PreprocToken::STRING_LITERAL:
+			token = Token(Token::Id::STRING_LITERAL);
+			token.set_string(std::string_view(ptr + 1, size - 2)); // strip quotes
+			break;
+		case PreprocToken::CHARACTER_CONSTANT:
+			token = Token(Token::Id::CHARACTER_CONSTANT);
+			token.set_string(std::string_view(ptr, size));
+			break;
+		default:
+			// header names and other pp-tokens in text lines are lexed from their text
+			if (!lex_text(ptr, line, col))
 				return;
-			}
-			token.set_coordinate(Coordinate(line_cntr, ptr - linebuf + 1));
-			m_token_list.push_back(token);
-			ptr = end;
+			continue;
+		}
+		if (end != ptr + size)
+		{
+			std::cerr << "Lexing error at line " << line << ". Could not interpret " << ptr << std::endl;
+			return;
 		}
+		token.set_coordinate(Coordinate(line, col));
+		m_token_list.push_back(token);
 	}
 }
 
@@ -11,27 +11,48 @@
 #ifndef LEXER_H_DEFINED
 #define LEXER_H_DEFINED
 
+#include "preproc_token.h"
 #include "token.h"
 
-#include <list>
+#include <string>
+#include <vector>
 
-/** @brief The lexer returns the tokens as a list of ::Token objects */
-using TokenList = std::list<Token>;
+/** @brief The lexer returns the tokens as a contiguous array of ::Token objects */
+using TokenList = std::vector<Token>;
 
 /**
- * @brief The ::Lexer class converts a text stream into a list of tokens
+ * @brief The ::Lexer class converts a text stream or a sequence of
+ * preprocessor tokens into a list of tokens
+ *
+ * @details The lexer owns the text the tokens refer to, so it must outlive its token list.
  */
 class Lexer
 {
 
 public:
+	Lexer() = default;
+
+	Lexer(Lexer const &other) = delete;
+
+	Lexer const &operator=(Lexer const &other) = delete;
+
 	/**
-	 * @brief Read a token list from an input stream and store it internally
+	 * @brief Read a token list from an input stream and store it internally, replacing the previous one
 	 *
 	 * @param is the input stream
 	 */
 	void lex_input(std::istream &is);
 
+	/**
+	 * @brief Convert preprocessor tokens into a token list and store it internally, replacing the previous one
+	 *
+	 * @details The pp-tokens are already delimited and classified by the preprocessor,
+	 * so their text is not scanned again, only converted.
+	 *
+	 * @param pp_tokens the preprocessed tokens including white spaces and new lines
+	 */
+	void lex_input(std::vector<PreprocToken> const &pp_tokens);
+
 	/**
 	 * @brief Display the token list in an output stream
 	 *
@@ -47,6 +68,19 @@ public:
 	TokenList const &get_token_list() const;
 
 private:
+	/** @brief Return t if the n characters of str spell keywrd, Token::Id::IDENTIFIER otherwise */
+	static Token::Id keyword_or_identifier(char const *str, char const *keywrd, size_t n, Token::Id t);
+
+	/** @brief Return the keyword id of the identifier str of length n, or Token::Id::IDENTIFIER */
+	static Token::Id classify_identifier(char const *str, size_t n);
+
+	static char const *lex_identifier(char const *str, Token *token);
+
+	/** @brief Return the keyword or identifier token of str, identifiers are interned */
+	static Token identifier_token(char const *str, size_t n);
+
+	static char const *lex_operator(char const *str, Token *token);
+
 	static char const *lex_floating_constant(char const *str, Token *token);
 
 	static char const *lex_decimal_integer_constant(char const *str, Token *token);
@@ -63,6 +97,15 @@ private:
 
 	static char const *read_next_token(char const *str, Token *token);
 
+	/**
+	 * @brief Lex a null terminated text that starts at the given coordinate
+	 *
+	 * @details The text may span any number of lines of any length.
+	 * @return false if a lexing error occurred
+	 */
+	bool lex_text(char const *str, size_t line, size_t col);
+
+	std::string m_text;		 ///< the text buffer of the token strings
 	TokenList m_token_list;
 };
 
@@ -1,6 +1,6 @@
 #include "local_table.h"
 
-void LocalTable::push(int scope, std::string const &var, size_t size, size_t align)
+void LocalTable::push(int scope, Symbol var, size_t size, size_t align)
 {
 	if (scope == 0)
 	{
@@ -16,21 +16,18 @@ void LocalTable::push(int scope, std::string const &var, size_t size, size_t ali
 	push_front(LocalTableEntry(var, offset, scope));
 }
 
-size_t LocalTable::offset(std::string const &id) const
+size_t LocalTable::offset(Symbol id) const
 {
-	for (auto s : *this)
+	for (auto const &s : *this)
 		if (s.get_id() == id)
 			return s.get_offset();
 	throw __FILE__ ": variable not found in local table";
 }
 
-std::string LocalTable::lookup(std::string const &id) const
+LocalTableEntry const &LocalTable::find(Symbol id) const
 {
-	for (auto s : *this)
+	for (auto const &s : *this)
 		if (s.get_id() == id)
-			if (s.get_scope() == 0) // global
-				return id + "(%rip)";
-			else // local
-				return std::to_string(-(long long)s.get_offset()) + "(%rbp)";
+			return s;
 	throw __FILE__ ": variable not found in local table";
 }
@@ -1,6 +1,8 @@
 #ifndef LOCAL_TABLE_H_INCLUDED
 #define LOCAL_TABLE_H_INCLUDED
 
+#include "symbol.h"
+
 #include <list>
 #include <utility>
 #include <string>
@@ -8,7 +10,7 @@
 class LocalTableEntry
 {
 public:
-	LocalTableEntry(std::string const &str, size_t offset, int scope)
+	LocalTableEntry(Symbol str, size_t offset, int scope)
 		: m_id(str), m_offset(offset), m_scope(scope)
 	{
 	}
@@ -17,10 +19,10 @@ public:
 
 	size_t get_offset() const { return m_offset; }
 
-	std::string const &get_id() const { return m_id; }
+	Symbol get_id() const { return m_id; }
 
 private:
-	std::string m_id;
+	Symbol m_id;
 	size_t m_offset;
 	int m_scope;
 };
@@ -28,13 +30,13 @@ private:
 class LocalTable : private std::list<LocalTableEntry>
 {
 public:
-	void push(int scope, std::string const &var, size_t size, size_t align);
+	void push(int scope, Symbol var, size_t size, size_t align);
 	
 	void pop() { pop_front(); }
 
-	std::string lookup(std::string const &id) const;
+	LocalTableEntry const &find(Symbol id) const;
 
-	size_t offset(std::string const &id) const;
+	size_t offset(Symbol id) const;
 
 	size_t get_size() const { return empty() ? 0 : front().get_offset(); }
 
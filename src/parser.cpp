@@ -34,7 +34,7 @@ XprNode *Parser::parse_integer_constant()
 		return nullptr;
 	}
 	int v = m_current_token->get_int_constant();
-	IntegerConstant *st = new IntegerConstant(Type::int_type(), &v);
+	IntegerConstant *st = AstNode::create<IntegerConstant>(Type::int_type(), &v);
 
 	next_token();
 
@@ -49,7 +49,7 @@ XprNode *Parser::parse_character_constant()
 		error_message("Error parsing character constant.");
 		return nullptr;
 	}
-	std::string str = m_current_token->get_string();
+	std::string str(m_current_token->get_string());
 	str = std::string(str.begin() + 1, str.end() - 1);
 	int v;
 	if (str[0] == '\\')
@@ -91,7 +91,7 @@ XprNode *Parser::parse_character_constant()
 	}
 	else
 		v = str[0];
-	IntegerConstant *st = new IntegerConstant(Type::int_type(), &v);
+	IntegerConstant *st = AstNode::create<IntegerConstant>(Type::int_type(), &v);
 
 	next_token();
 
@@ -106,7 +106,7 @@ XprNode *Parser::parse_floating_constant()
 		error_message("Error parsing floating constant.");
 		return nullptr;
 	}
-	FloatingConstant *st = new FloatingConstant;
+	FloatingConstant *st = AstNode::create<FloatingConstant>();
 	st->set_xpr_type(Type::double_type());
 	st->set_value(m_current_token->get_double_constant());
 	get_translation_unit()->add_floating_constant(m_current_token->get_double_constant());
@@ -122,8 +122,8 @@ XprNode *Parser::parse_string_literal()
 		error_message("Error parsing string literal");
 		return nullptr;
 	}
-	std::string const &str = m_current_token->get_string();
-	StringLiteralNode *st = new StringLiteralNode(str);
+	Symbol str(m_current_token->get_string());
+	StringLiteralNode *st = AstNode::create<StringLiteralNode>(str);
 	get_translation_unit()->add_string_literal(str);
 	next_token();
 	return st;
@@ -136,28 +136,28 @@ XprNode *Parser::parse_identifier(bool type_check_needed)
 		error_message("Error parsing identifier");
 		return nullptr;
 	}
-	std::string const &id = m_current_token->get_string();
+	Symbol id = m_current_token->get_symbol();
 	next_token();
 
 	if (type_check_needed)
 	{
 		int const *pc = m_st_ptr->lookup_constant_global(id);
 		if (pc != nullptr)
-			return new IntegerConstant(Type::int_type(), pc);
+			return AstNode::create<IntegerConstant>(Type::int_type(), pc);
 		auto ps = m_st_ptr->lookup_global(id);
 		if (ps != nullptr && (ps->is_object() || ps->is_function()))
 		{
-			IdentifierXprNode *st = new IdentifierXprNode(XprNode::Id::IDENTIFIER);
+			IdentifierXprNode *st = AstNode::create<IdentifierXprNode>(XprNode::Id::IDENTIFIER);
 			st->set_identifier(id);
 			st->set_xpr_type(ps->get_type());
 			return st;
 		}
-		error_message("Undeclared identifier: " + id);
+		error_message("Undeclared identifier: " + id.str());
 		return nullptr;
 	}
 	else
 	{
-		IdentifierXprNode *st = new IdentifierXprNode(XprNode::Id::IDENTIFIER);
+		IdentifierXprNode *st = AstNode::create<IdentifierXprNode>(XprNode::Id::IDENTIFIER);
 		st->set_identifier(id);
 		return st;
 	}
@@ -170,7 +170,7 @@ bool Parser::is_type_specifier(Token const *t) const
 		return true;
 	if (tt == Token::Id::IDENTIFIER)
 	{
-		auto pste = m_st_ptr->lookup_global(t->get_string());
+		auto pste = m_st_ptr->lookup_global(t->get_symbol());
 		if (pste != nullptr && pste->get_category() == SymbolTableEntry::TYPE)
 			return true;
 	}
@@ -209,8 +209,8 @@ XprNode *Parser::parse_fieldname()
 {
 	if (m_current_token->get_id() != Token::Id::IDENTIFIER)
 		return nullptr;
-	IdentifierXprNode *st = new IdentifierXprNode(XprNode::Id::FIELDNAME_XPR);
-	st->set_identifier(m_current_token->get_string());
+	IdentifierXprNode *st = AstNode::create<IdentifierXprNode>(XprNode::Id::FIELDNAME_XPR);
+	st->set_identifier(m_current_token->get_symbol());
 	next_token();
 
 	return st;
@@ -256,7 +256,6 @@ XprNode *Parser::parse_primary_expression()
 
 	if (!expect(Token::Id::PARENTHESES_CLOSE))
 	{
-		delete st;
 		return nullptr;
 	}
 
@@ -293,12 +292,11 @@ XprNode *Parser::parse_postfix_expression()
 		if (token_id == Token::Id::INCREMENT || token_id == Token::Id::DECREMENT)
 		{
 			next_token();
-			PostfixXprNode *n = new PostfixXprNode(token_id == Token::Id::INCREMENT ? XprNode::Id::POSTINCREMENT : XprNode::Id::POSTDECREMENT);
+			PostfixXprNode *n = AstNode::create<PostfixXprNode>(token_id == Token::Id::INCREMENT ? XprNode::Id::POSTINCREMENT : XprNode::Id::POSTDECREMENT);
 			n->add_subxpr(ret);
 			if (!n->type_check())
 			{
 				error_message("Error type checking postincrement expression");
-				delete n;
 				return nullptr;
 			}
 			ret = n;
@@ -310,22 +308,18 @@ XprNode *Parser::parse_postfix_expression()
 			if (idx_xpr == nullptr)
 			{
 				error_message("Error parsing index expression of array subscript");
-				delete ret;
 				return nullptr;
 			}
 			if (!expect(Token::Id::BRACKET_CLOSE))
 			{
-				delete idx_xpr;
-				delete ret;
 				return nullptr;
 			}
-			PostfixXprNode *n = new PostfixXprNode(XprNode::Id::ARRAY_SUBSCRIPT);
+			PostfixXprNode *n = AstNode::create<PostfixXprNode>(XprNode::Id::ARRAY_SUBSCRIPT);
 			n->add_subxpr(ret);
 			n->add_subxpr(idx_xpr);
 			if (!n->type_check())
 			{
 				error_message("Error while parsing array subscript expression");
-				delete n;
 				return nullptr;
 			}
 			ret = n;
@@ -333,7 +327,7 @@ XprNode *Parser::parse_postfix_expression()
 		else if (token_id == Token::Id::PARENTHESES_OPEN)
 		{
 			expect(Token::Id::PARENTHESES_OPEN);
-			PostfixXprNode *function = new PostfixXprNode(XprNode::Id::FUNCTION_CALL);
+			PostfixXprNode *function = AstNode::create<PostfixXprNode>(XprNode::Id::FUNCTION_CALL);
 			function->add_subxpr(ret);
 			bool was_comma = false;
 			while (was_comma || m_current_token->get_id() != Token::Id::PARENTHESES_CLOSE)
@@ -342,7 +336,6 @@ XprNode *Parser::parse_postfix_expression()
 				if (x == nullptr)
 				{
 					error_message("Error parsing function argument expression");
-					delete function;
 					return nullptr;
 				}
 				function->add_subxpr(x);
@@ -359,7 +352,6 @@ XprNode *Parser::parse_postfix_expression()
 			if (!function->type_check())
 			{
 				error_message("Error type checking function call expression");
-				delete function;
 				return nullptr;
 			}
 			ret = function;
@@ -368,13 +360,12 @@ XprNode *Parser::parse_postfix_expression()
 		{
 			next_token();
 			XprNode *fld = parse_fieldname();
-			PostfixXprNode *n = new PostfixXprNode(token_id == Token::Id::POINT ? XprNode::Id::STRUCTURE_MEMBER : XprNode::Id::STRUCTURE_PTR_MEMBER);
+			PostfixXprNode *n = AstNode::create<PostfixXprNode>(token_id == Token::Id::POINT ? XprNode::Id::STRUCTURE_MEMBER : XprNode::Id::STRUCTURE_PTR_MEMBER);
 			n->add_subxpr(ret);
 			n->add_subxpr(fld);
 			if (!n->type_check())
 			{
 				error_message("Error type checking structure member or pointer to member expression");
-				delete n;
 				return nullptr;
 			}
 			ret = n;
@@ -418,7 +409,7 @@ XprNode *Parser::parse_unary_expression()
 				error_message("Error parsing unary expression");
 				return nullptr;
 			}
-			UnaryXprNode *st = new UnaryXprNode(data1[i].st);
+			UnaryXprNode *st = AstNode::create<UnaryXprNode>(data1[i].st);
 			st->add_subxpr(c);
 			if (!st->type_check())
 			{
@@ -455,7 +446,7 @@ XprNode *Parser::parse_unary_expression()
 				error_message("Error parsing cast expression");
 				return nullptr;
 			}
-			UnaryXprNode *st = new UnaryXprNode(data[i].st);
+			UnaryXprNode *st = AstNode::create<UnaryXprNode>(data[i].st);
 			st->add_subxpr(c);
 			if (!st->type_check())
 			{
@@ -488,18 +479,16 @@ XprNode *Parser::parse_unary_expression()
 					error_message("Error parsing ( expression )");
 					return nullptr;
 				}
-				XprNode *a = new UnaryXprNode(XprNode::Id::SIZEOF);
+				XprNode *a = AstNode::create<UnaryXprNode>(XprNode::Id::SIZEOF);
 				a->add_subxpr(c);
 
 				if (!a->type_check())
 				{
 					error_message("Error type checking sizeof expression");
-					delete a;
 					return nullptr;
 				}
 
 				val = c->get_xpr_type().get_size_in_bytes();
-				delete a;
 			}
 
 			if (!expect(Token::Id::PARENTHESES_CLOSE))
@@ -516,22 +505,20 @@ XprNode *Parser::parse_unary_expression()
 				error_message("Error parsing unary expression");
 				return nullptr;
 			}
-			XprNode *a = new UnaryXprNode(XprNode::Id::SIZEOF);
+			XprNode *a = AstNode::create<UnaryXprNode>(XprNode::Id::SIZEOF);
 			a->add_subxpr(c);
 
 			if (!a->type_check())
 			{
 				error_message("Error type checking sizeof expression");
-				delete a;
 				return nullptr;
 			}
 
 			val = c->get_xpr_type().get_size_in_bytes();
-			delete a;
 		}
 
 		// todo return type (size_t) should be selected properly
-		return new IntegerConstant(Type::ullong_type(), &val);
+		return AstNode::create<IntegerConstant>(Type::ullong_type(), &val);
 	}
 
 	return parse_postfix_expression();
@@ -577,33 +564,27 @@ XprNode *Parser::parse_conditional_expression()
 	XprNode *xprt = parse_expression();
 	if (xprt == nullptr)
 	{
-		delete cnd;
 		return nullptr;
 	}
 
 	if (!expect(Token::Id::COLON))
 	{
-		delete cnd;
-		delete xprt;
 		return nullptr;
 	}
 
 	XprNode *xprf = parse_conditional_expression();
 	if (xprf == nullptr)
 	{
-		delete cnd;
-		delete xprt;
 		return nullptr;
 	}
 
-	ConditionalXprNode *res = new ConditionalXprNode;
+	ConditionalXprNode *res = AstNode::create<ConditionalXprNode>();
 	res->add_subxpr(cnd);
 	res->add_subxpr(xprt);
 	res->add_subxpr(xprf);
 	if (!res->type_check())
 	{
 		error_message("Error type checking conditional expression");
-		delete res;
 		return nullptr;
 	}
 	return res;
@@ -649,17 +630,15 @@ XprNode *Parser::parse_assignment_expression()
 		XprNode *rhs = parse_assignment_expression();
 		if (rhs == nullptr)
 		{
-			delete lhs;
 			error_message("Error parsing assignment expression");
 			return nullptr;
 		}
 
-		AssignmentXprNode *n = new AssignmentXprNode(data[i].st);
+		AssignmentXprNode *n = AstNode::create<AssignmentXprNode>(data[i].st);
 		n->add_subxpr(lhs);
 		n->add_subxpr(rhs);
 		if (!n->type_check())
 		{
-			delete n;
 			error_message("Error type checking assignment expression");
 			return nullptr;
 		}
@@ -698,13 +677,12 @@ XprNode *Parser::parse_cast_expression()
 				error_message("Error parsing cast expression");
 				return nullptr;
 			}
-			CastXprNode *xpr = new CastXprNode;
+			CastXprNode *xpr = AstNode::create<CastXprNode>();
 			xpr->add_subxpr(rhs);
 			xpr->set_xpr_type(t);
 			if (!xpr->type_check())
 			{
 				error_message("Error type checking cast expression");
-				delete xpr;
 				return nullptr;
 			}
 			return xpr;
@@ -742,18 +720,16 @@ XprNode *Parser::parse_binary_xpr(size_t prec)
 			rhs = parse_binary_xpr(prec - 1);
 		if (rhs == nullptr)
 		{
-			delete lhs;
 			return nullptr;
 		}
 
-		XprNode *res = new BinaryXprNode(op);
+		XprNode *res = AstNode::create<BinaryXprNode>(op);
 		res->add_subxpr(lhs);
 		res->add_subxpr(rhs);
 		lhs = res;
 		if (!res->type_check())
 		{
 			error_message("Type check of binary expression failed");
-			delete res;
 			return nullptr;
 		}
 	}
@@ -895,7 +871,7 @@ bool Parser::parse_direct_declarator(Declaration *decl)
 
 	if (!jump_to_post && m_current_token->get_id() == Token::Id::IDENTIFIER)
 	{
-		decl->set_identifier(m_current_token->get_string());
+		decl->set_identifier(m_current_token->get_symbol());
 		next_token();
 	}
 
@@ -906,7 +882,7 @@ bool Parser::parse_direct_declarator(Declaration *decl)
 	}
 
 	decl->set_type(inner.get_type().replace_back_to(decl->get_type()));
-	if (decl->get_identifier() == "" && inner.get_identifier() != "")
+	if (decl->get_identifier().empty() && !inner.get_identifier().empty())
 		decl->set_identifier(inner.get_identifier());
 
 	return true;
@@ -928,7 +904,7 @@ bool Parser::parse_declarator(Declaration *decl)
 	return parse_direct_declarator(decl);
 }
 
-bool Parser::parse_struct_specifier(std::string *type_name)
+bool Parser::parse_struct_specifier(Symbol *type_name)
 {
 	if (!expect(Token::Id::STRUCT))
 	{
@@ -947,7 +923,7 @@ bool Parser::parse_struct_specifier(std::string *type_name)
 		struct_tag = generate_anonymous_enum_tag();
 
 	// determine full enum name. This identifies the type in the symbol table
-	std::string struct_name = "struct " + struct_tag;
+	Symbol struct_name("struct " + struct_tag);
 
 	if (m_current_token->get_id() != Token::Id::BRACE_OPEN)
 	{
@@ -1002,7 +978,7 @@ bool Parser::parse_struct_specifier(std::string *type_name)
 	return true;
 }
 
-bool Parser::parse_enum_specifier(std::string *type_name)
+bool Parser::parse_enum_specifier(Symbol *type_name)
 {
 	if (!expect(Token::Id::ENUM))
 	{
@@ -1021,7 +997,7 @@ bool Parser::parse_enum_specifier(std::string *type_name)
 		enum_tag = generate_anonymous_enum_tag();
 
 	// determine full enum name. This identifies the type in the symbol table
-	std::string enum_name = "enum " + enum_tag;
+	Symbol enum_name("enum " + enum_tag);
 
 	if (m_current_token->get_id() != Token::Id::BRACE_OPEN)
 	{
@@ -1067,7 +1043,7 @@ bool Parser::parse_enum_specifier(std::string *type_name)
 
 		while (m_current_token->get_id() == Token::Id::IDENTIFIER)
 		{
-			std::string enum_symbol = m_current_token->get_string();
+			Symbol enum_symbol = m_current_token->get_symbol();
 			next_token();
 			if (m_current_token->get_id() == Token::Id::ASSIGN)
 			{
@@ -1076,15 +1052,14 @@ bool Parser::parse_enum_specifier(std::string *type_name)
 				if (xpr == nullptr || !xpr->is_constant_expression())
 				{
 					error_message("Could not parse constant expression in enumerator");
-					delete xpr;
 					return false;
 				}
 				c = xpr->evaluate_constant();
 			}
 
-			if (enum_type->lookup_enum_constant(enum_symbol) != nullptr)
+			if (!m_st_ptr->install_constant(enum_symbol, c))
 			{
-				error_message("Redefinition of enumeration constant: " + enum_symbol);
+				error_message("Redefinition of enumeration constant: " + enum_symbol.str());
 				return false;
 			}
 			enum_type->add_enum_constant(enum_symbol, c++);
@@ -1107,7 +1082,7 @@ bool Parser::parse_enum_specifier(std::string *type_name)
 bool Parser::parse_declaration_specifiers(Declaration *decl)
 {
 	std::vector<Token::Id> type_specifiers, type_qualifiers;
-	std::string typedef_name = "";
+	Symbol typedef_name;
 
 	decl->set_typedef(false);
 	decl->set_storage(Storage::NO_STORAGE);
@@ -1150,7 +1125,7 @@ bool Parser::parse_declaration_specifiers(Declaration *decl)
 			}
 			next_token();
 		}
-		else if (typedef_name == "" && is_type_specifier(m_current_token))
+		else if (typedef_name.empty() && is_type_specifier(m_current_token))
 		{
 			// if typedef name
 			if (m_current_token->get_id() == Token::Id::IDENTIFIER)
@@ -1161,10 +1136,10 @@ bool Parser::parse_declaration_specifiers(Declaration *decl)
 				if (!type_specifiers.empty())
 					break;
 
-				auto pste = m_st_ptr->lookup_global(m_current_token->get_string());
+				auto pste = m_st_ptr->lookup_global(m_current_token->get_symbol());
 				if (pste != nullptr && pste->get_category() == SymbolTableEntry::TYPE)
 				{
-					typedef_name = m_current_token->get_string();
+					typedef_name = m_current_token->get_symbol();
 					next_token();
 				}
 			}
@@ -1209,7 +1184,7 @@ bool Parser::parse_declaration_specifiers(Declaration *decl)
 	}
 
 	// determine base type from type specifier
-	if (typedef_name != "")
+	if (!typedef_name.empty())
 	{
 		if (!type_specifiers.empty())
 		{
@@ -1220,7 +1195,7 @@ bool Parser::parse_declaration_specifiers(Declaration *decl)
 		auto *pste = m_st_ptr->lookup_global(typedef_name);
 		if (pste == nullptr)
 		{
-			error_message("Did not find identifier " + typedef_name + " in the type table");
+			error_message("Did not find identifier " + typedef_name.str() + " in the type table");
 			return false;
 		}
 		decl->set_type(pste->get_type());
@@ -1345,12 +1320,12 @@ XprNode *Parser::parse_initializer(XprNode *lhs)
 			bool first = i_member == 0;
 
 			// transform lhs into an appropriate array subscript expression
-			PostfixXprNode *member = new PostfixXprNode(XprNode::Id::STRUCTURE_MEMBER);
+			PostfixXprNode *member = AstNode::create<PostfixXprNode>(XprNode::Id::STRUCTURE_MEMBER);
 			if (first)
 				member->add_subxpr(lhs);
 			else
 				member->add_subxpr(lhs->clone());
-			member->add_subxpr(new IdentifierXprNode(XprNode::Id::FIELDNAME_XPR, type.get_declaration(i_member).get_identifier()));
+			member->add_subxpr(AstNode::create<IdentifierXprNode>(XprNode::Id::FIELDNAME_XPR, type.get_declaration(i_member).get_identifier()));
 			member->type_check();
 
 			// parse initializer
@@ -1367,7 +1342,7 @@ XprNode *Parser::parse_initializer(XprNode *lhs)
 			if (i_member < n_members - 1)
 			{
 				expect(Token::Id::COMMA);
-				XprNode *comma = new BinaryXprNode(XprNode::Id::COMMA);
+				XprNode *comma = AstNode::create<BinaryXprNode>(XprNode::Id::COMMA);
 				comma->add_subxpr(xpr);
 				xpr = comma;
 			}
@@ -1385,12 +1360,12 @@ XprNode *Parser::parse_initializer(XprNode *lhs)
 			bool first = element_cntr == 0;
 
 			// transform lhs into an appropriate array subscript expression
-			PostfixXprNode *arr_sbs = new PostfixXprNode(XprNode::Id::ARRAY_SUBSCRIPT);
+			PostfixXprNode *arr_sbs = AstNode::create<PostfixXprNode>(XprNode::Id::ARRAY_SUBSCRIPT);
 			if (first)
 				arr_sbs->add_subxpr(lhs);
 			else
 				arr_sbs->add_subxpr(lhs->clone());
-			arr_sbs->add_subxpr(new IntegerConstant(Type::ulong_type(), &element_cntr));
+			arr_sbs->add_subxpr(AstNode::create<IntegerConstant>(Type::ulong_type(), &element_cntr));
 			element_cntr++;
 			arr_sbs->type_check();
 
@@ -1407,7 +1382,7 @@ XprNode *Parser::parse_initializer(XprNode *lhs)
 
 			if (m_current_token->get_id() == Token::Id::COMMA)
 			{
-				XprNode *comma = new BinaryXprNode(XprNode::Id::COMMA);
+				XprNode *comma = AstNode::create<BinaryXprNode>(XprNode::Id::COMMA);
 				comma->add_subxpr(xpr);
 				xpr = comma;
 				next_token();
@@ -1424,7 +1399,7 @@ XprNode *Parser::parse_initializer(XprNode *lhs)
 	else
 	{
 		XprNode *rhs = parse_assignment_expression();
-		AssignmentXprNode *ret = new AssignmentXprNode(XprNode::Id::ASSIGN);
+		AssignmentXprNode *ret = AstNode::create<AssignmentXprNode>(XprNode::Id::ASSIGN);
 		ret->add_subxpr(lhs);
 		ret->add_subxpr(rhs);
 		ret->type_check();
@@ -1474,11 +1449,11 @@ bool Parser::parse_declaration()
 		if (m_current_token->get_id() == Token::Id::ASSIGN)
 		{
 			next_token();
-			IdentifierXprNode *lhs = new IdentifierXprNode(XprNode::Id::IDENTIFIER);
+			IdentifierXprNode *lhs = AstNode::create<IdentifierXprNode>(XprNode::Id::IDENTIFIER);
 			lhs->set_xpr_type(decl.get_type());
 			lhs->set_identifier(decl.get_identifier());
 			XprNode *xpr = parse_initializer(lhs);
-			auto init = std::make_shared<StmNode>(StmNode::Id::XPR);
+			auto init = AstNode::create<StmNode>(StmNode::Id::XPR);
 			init->add_subxpr(xpr);
 			m_current_block->add_substm(init);
 		}
@@ -1512,7 +1487,7 @@ bool Parser::parse_declarations()
 	return true;
 }
 
-std::shared_ptr<StmNode> Parser::parse_return_statement()
+StmNode *Parser::parse_return_statement()
 {
 	XprNode *xpr = nullptr;
 	if (!expect(Token::Id::RETURN))
@@ -1529,33 +1504,32 @@ std::shared_ptr<StmNode> Parser::parse_return_statement()
 	if (!expect(Token::Id::SEMICOLON))
 	{
 		error_message("Missing semicolon after return statement");
-		delete xpr;
 	}
-	auto stm = std::make_shared<StmNode>(StmNode::Id::RETURN);
+	auto stm = AstNode::create<StmNode>(StmNode::Id::RETURN);
 	if (xpr != nullptr)
 		stm->add_subxpr(xpr);
 	return stm;
 }
 
-std::shared_ptr<StmNode> Parser::parse_break_statement()
+StmNode *Parser::parse_break_statement()
 {
 	if (!expect(Token::Id::BREAK))
 		return nullptr;
 	if (!expect(Token::Id::SEMICOLON))
 		return nullptr;
-	return std::make_shared<StmNode>(StmNode::Id::BREAK);
+	return AstNode::create<StmNode>(StmNode::Id::BREAK);
 }
 
-std::shared_ptr<StmNode> Parser::parse_continue_statement()
+StmNode *Parser::parse_continue_statement()
 {
 	if (!expect(Token::Id::CONTINUE))
 		return nullptr;
 	if (!expect(Token::Id::SEMICOLON))
 		return nullptr;
-	return std::make_shared<StmNode>(StmNode::Id::CONTINUE);
+	return AstNode::create<StmNode>(StmNode::Id::CONTINUE);
 }
 
-std::shared_ptr<StmNode> Parser::parse_if_statement()
+StmNode *Parser::parse_if_statement()
 {
 	if (!expect(Token::Id::IF))
 		return nullptr;
@@ -1563,13 +1537,12 @@ std::shared_ptr<StmNode> Parser::parse_if_statement()
 	if (!expect(Token::Id::PARENTHESES_OPEN))
 		return nullptr;
 
-	auto wh = std::make_shared<StmNode>(StmNode::Id::IF);
+	auto wh = AstNode::create<StmNode>(StmNode::Id::IF);
 
 	auto xpr = parse_expression();
 
 	if (!expect(Token::Id::PARENTHESES_CLOSE))
 	{
-		delete xpr;
 		return nullptr;
 	}
 	wh->add_subxpr(xpr);
@@ -1586,7 +1559,6 @@ std::shared_ptr<StmNode> Parser::parse_if_statement()
 		auto fls_stm = parse_statement();
 		if (fls_stm == nullptr)
 		{
-			delete xpr;
 			return nullptr;
 		}
 		wh->add_substm(fls_stm);
@@ -1595,7 +1567,7 @@ std::shared_ptr<StmNode> Parser::parse_if_statement()
 	return wh;
 }
 
-std::shared_ptr<StmNode> Parser::parse_while_statement()
+StmNode *Parser::parse_while_statement()
 {
 	if (!expect(Token::Id::WHILE))
 		return nullptr;
@@ -1617,17 +1589,16 @@ std::shared_ptr<StmNode> Parser::parse_while_statement()
 	if (stm == nullptr)
 	{
 		error_message("Error parsing the body of a while statement");
-		delete xpr;
 		return nullptr;
 	}
 
-	auto wh = std::make_shared<StmNode>(StmNode::Id::WHILE);
+	auto wh = AstNode::create<StmNode>(StmNode::Id::WHILE);
 	wh->add_subxpr(xpr);
 	wh->add_substm(stm);
 	return wh;
 }
 
-std::shared_ptr<StmNode> Parser::parse_do_statement()
+StmNode *Parser::parse_do_statement()
 {
 	if (!expect(Token::Id::DO))
 	{
@@ -1664,24 +1635,22 @@ std::shared_ptr<StmNode> Parser::parse_do_statement()
 	if (!expect(Token::Id::PARENTHESES_CLOSE))
 	{
 		error_message("Missing closing parenthesis \")\" in the condition of a do-while statement");
-		delete xpr;
 		return nullptr;
 	}
 
 	if (!expect(Token::Id::SEMICOLON))
 	{
 		error_message("Missing semicolon after a do-while statement");
-		delete xpr;
 		return nullptr;
 	}
 
-	auto dwh = std::make_shared<StmNode>(StmNode::Id::DO);
+	auto dwh = AstNode::create<StmNode>(StmNode::Id::DO);
 	dwh->add_subxpr(xpr);
 	dwh->add_substm(stm);
 	return dwh;
 }
 
-std::shared_ptr<StmNode> Parser::parse_for_statement()
+StmNode *Parser::parse_for_statement()
 {
 	if (!expect(Token::Id::FOR))
 		return nullptr;
@@ -1704,7 +1673,7 @@ std::shared_ptr<StmNode> Parser::parse_for_statement()
 	}
 	else
 	{
-		IntegerConstant *x = new IntegerConstant;
+		IntegerConstant *x = AstNode::create<IntegerConstant>();
 		x->set_xpr_type(Type::int_type());
 		int v = 1;
 		x->set_value(&v);
@@ -1713,7 +1682,6 @@ std::shared_ptr<StmNode> Parser::parse_for_statement()
 	if (!expect(Token::Id::SEMICOLON))
 	{
 		error_message("Missing semicolon after initializing expression of for statement");
-		delete init;
 		return nullptr;
 	}
 	if (m_current_token->get_id() != Token::Id::SEMICOLON)
@@ -1722,13 +1690,12 @@ std::shared_ptr<StmNode> Parser::parse_for_statement()
 		if (xpr == nullptr)
 		{
 			error_message("Error parsing condition expression in for statement");
-			delete init;
 			return nullptr;
 		}
 	}
 	else
 	{
-		IntegerConstant *x = new IntegerConstant;
+		IntegerConstant *x = AstNode::create<IntegerConstant>();
 		x->set_xpr_type(Type::int_type());
 		int v = 1;
 		x->set_value(&v);
@@ -1737,8 +1704,6 @@ std::shared_ptr<StmNode> Parser::parse_for_statement()
 	if (!expect(Token::Id::SEMICOLON))
 	{
 		error_message("Missing semicolon after condition expression of for statement");
-		delete init;
-		delete xpr;
 		return nullptr;
 	}
 	if (m_current_token->get_id() != Token::Id::PARENTHESES_CLOSE)
@@ -1747,14 +1712,12 @@ std::shared_ptr<StmNode> Parser::parse_for_statement()
 		if (step == nullptr)
 		{
 			error_message("Error parsing step expression in for statement");
-			delete init;
-			delete xpr;
 			return nullptr;
 		}
 	}
 	else
 	{
-		IntegerConstant *x = new IntegerConstant;
+		IntegerConstant *x = AstNode::create<IntegerConstant>();
 		x->set_xpr_type(Type::int_type());
 		int v = 1;
 		x->set_value(&v);
@@ -1764,22 +1727,16 @@ std::shared_ptr<StmNode> Parser::parse_for_statement()
 	if (!expect(Token::Id::PARENTHESES_CLOSE))
 	{
 		error_message("Missing closing parenthesis after step expression of for statement");
-		delete init;
-		delete xpr;
-		delete step;
 		return nullptr;
 	}
 	auto stm = parse_statement();
 	if (stm == nullptr)
 	{
 		error_message("Error parsing the body of a for statement");
-		delete init;
-		delete xpr;
-		delete step;
 		return nullptr;
 	}
 
-	auto fr = std::make_shared<StmNode>(StmNode::Id::FOR);
+	auto fr = AstNode::create<StmNode>(StmNode::Id::FOR);
 	fr->add_subxpr(init);
 	fr->add_subxpr(xpr);
 	fr->add_subxpr(step);
@@ -1787,14 +1744,14 @@ std::shared_ptr<StmNode> Parser::parse_for_statement()
 	return fr;
 }
 
-std::shared_ptr<StmNode> Parser::parse_empty_statement()
+StmNode *Parser::parse_empty_statement()
 {
 	if (!expect(Token::Id::SEMICOLON))
 		return nullptr;
-	return std::make_shared<StmNode>(StmNode::Id::EMPTY);
+	return AstNode::create<StmNode>(StmNode::Id::EMPTY);
 }
 
-std::shared_ptr<StmNode> Parser::parse_expression_statement()
+StmNode *Parser::parse_expression_statement()
 {
 	// expression statement
 	XprNode *xpr = parse_expression();
@@ -1803,7 +1760,7 @@ std::shared_ptr<StmNode> Parser::parse_expression_statement()
 		error_message("Error parsing expression in expression statement.");
 		return nullptr;
 	}
-	auto xprstm = std::make_shared<StmNode>(StmNode::Id::XPR);
+	auto xprstm = AstNode::create<StmNode>(StmNode::Id::XPR);
 	xprstm->add_subxpr(xpr);
 	if (!expect(Token::Id::SEMICOLON))
 	{
@@ -1813,7 +1770,7 @@ std::shared_ptr<StmNode> Parser::parse_expression_statement()
 	return xprstm;
 }
 
-std::shared_ptr<StmNode> Parser::parse_statement()
+StmNode *Parser::parse_statement()
 {
 	if (m_current_token->get_id() == Token::Id::SEMICOLON)
 		return parse_empty_statement();
@@ -1845,7 +1802,7 @@ std::shared_ptr<StmNode> Parser::parse_statement()
 	return parse_expression_statement();
 }
 
-std::shared_ptr<CompoundNode> Parser::parse_compound_statement()
+CompoundNode *Parser::parse_compound_statement()
 {
 	if (!expect(Token::Id::BRACE_OPEN))
 	{
@@ -1855,14 +1812,13 @@ std::shared_ptr<CompoundNode> Parser::parse_compound_statement()
 
 	enter_scope();
 
-	auto block = std::make_shared<CompoundNode>();
+	auto block = AstNode::create<CompoundNode>();
 	m_current_block = block;
 	block->set_symbol_pointer(m_st_ptr);
 
 	if (!parse_declarations())
 	{
 		error_message("Error parsing declarations at beginning of block");
-		delete m_st_ptr;
 		return nullptr;
 	}
 
@@ -1937,13 +1893,13 @@ bool Parser::check_declaration(Declaration *decl)
 			auto ptr = m_st_ptr->lookup_local(decl->get_identifier());
 			if (ptr != nullptr && ptr->get_type() != decl->get_type())
 			{
-				error_message("Redeclaration of typedef-name " + decl->get_identifier() + " with different type");
+				error_message("Redeclaration of typedef-name " + decl->get_identifier().str() + " with different type");
 				return false;
 			}
 		}
 		else
 		{
-			error_message("Redefinition of identifier " + decl->get_identifier());
+			error_message("Redefinition of identifier " + decl->get_identifier().str());
 			return false;
 		}
 	}
@@ -2105,19 +2061,15 @@ bool Parser::parse()
 
 void Parser::next_token(void)
 {
-	if (m_token_list_ptr == m_token_list_end)
+	if (m_token_index == m_token_list.size())
 		m_current_token = &m_token_eof;
 	else
-	{
-		m_current_token = &*m_token_list_ptr;
-		++m_token_list_ptr;
-	}
+		m_current_token = &m_token_list[m_token_index++];
 }
 
 void Parser::previous_token(void)
 {
-	--m_token_list_ptr;
-	--m_token_list_ptr;
+	m_token_index -= 2;
 	next_token();
 }
 
@@ -2125,7 +2077,7 @@ bool Parser::expect(Token::Id t)
 {
 	if (m_current_token->get_id() != t)
 	{
-		error_message("Expecting token: \"" + Token(t).get_string() + "\". Receiving token: \"" + m_current_token->get_string() + "\".");
+		error_message("Expecting token: \"" + std::string(Token(t).get_string()) + "\". Receiving token: \"" + std::string(m_current_token->get_string()) + "\".");
 		return false;
 	}
 	next_token();
@@ -55,24 +55,24 @@ private:
 	bool parse_post_declarator(Declaration *decl);
 	bool parse_direct_declarator(Declaration *decl);
 	bool parse_declarator(Declaration *decl);
-	bool parse_struct_specifier(std::string *typedef_name);
-	bool parse_enum_specifier(std::string *typedef_name);
+	bool parse_struct_specifier(Symbol *typedef_name);
+	bool parse_enum_specifier(Symbol *typedef_name);
 	bool parse_declaration_specifiers(Declaration *decl);
 	bool parse_struct_declaration(std::vector<Declaration> *declarations);
 	bool parse_declaration();
 	bool parse_declarations();
 
-	std::shared_ptr<StmNode> parse_return_statement();
-	std::shared_ptr<StmNode> parse_break_statement();
-	std::shared_ptr<StmNode> parse_continue_statement();
-	std::shared_ptr<StmNode> parse_if_statement();
-	std::shared_ptr<StmNode> parse_while_statement();
-	std::shared_ptr<StmNode> parse_do_statement();
-	std::shared_ptr<StmNode> parse_for_statement();
-	std::shared_ptr<StmNode> parse_empty_statement();
-	std::shared_ptr<StmNode> parse_expression_statement();
-	std::shared_ptr<StmNode> parse_statement();
-	std::shared_ptr<CompoundNode> parse_compound_statement();
+	StmNode *parse_return_statement();
+	StmNode *parse_break_statement();
+	StmNode *parse_continue_statement();
+	StmNode *parse_if_statement();
+	StmNode *parse_while_statement();
+	StmNode *parse_do_statement();
+	StmNode *parse_for_statement();
+	StmNode *parse_empty_statement();
+	StmNode *parse_expression_statement();
+	StmNode *parse_statement();
+	CompoundNode *parse_compound_statement();
 
 	/**
 	 * @brief Parse a translation unit and return the pointer to its AST node
@@ -123,8 +123,8 @@ public:
 	Parser(TokenList const &tl)
 		: m_token_list(tl)
 		, m_token_eof(Token::Id::END_OF_FILE)
-		, m_token_list_ptr(tl.begin())
-		, m_token_list_end(tl.cend())
+		, m_token_index(0)
+		, m_current_block(nullptr)
 		, m_translation_unit(nullptr)
 		, m_st_ptr(nullptr)
 		, m_enum_counter(0)
@@ -151,10 +151,10 @@ public:
 private:
 	TokenList const &m_token_list;
 	Token m_token_eof;
-	TokenList::const_iterator m_token_list_ptr, m_token_list_end;
+	size_t m_token_index;	// index of the token following the current one
 	Token const *m_current_token;
 
-	std::shared_ptr<CompoundNode> m_current_block;
+	CompoundNode *m_current_block;
 
 	TransUnitNode *m_translation_unit;	// root of the AST
 	SymbolNode *m_st_ptr;	// pointer to the current symbol table node
@@ -0,0 +1,166 @@
+#include "peephole.h"
+
+#include <iomanip>
+#include <string>
+
+Peephole::Rule const Peephole::m_rules[] = {
+	{"mov to itself", 1, mov_self},
+	{"push and pop", 2, push_pop},
+	{"stack pointer adjustments", 2, stack_adjust},
+	{"unreachable instruction", 2, unreachable},
+	{"jmp to next label", 2, jmp_next},
+	{"load after store", 2, store_load}};
+
+size_t const Peephole::m_num_rules = sizeof m_rules / sizeof m_rules[0];
+
+/** @brief Determine if an operand is the 64 bit stack pointer */
+static bool is_stack_pointer(Operand const &op)
+{
+	return op.get_kind() == Operand::REGISTER && op == Operand(Register(Register::Id::SP));
+}
+
+/** @brief Determine if an instruction adds a constant to the stack pointer, and return the constant */
+static bool is_stack_adjust(Instruction const &instr, long long &delta)
+{
+	Instruction::Opcode op = instr.get_opcode();
+	if ((op != Instruction::ADD && op != Instruction::SUB) || !is_stack_pointer(instr.get_dst()) ||
+		instr.get_src().get_kind() != Operand::IMMEDIATE)
+		return false;
+	delta = op == Instruction::ADD ? instr.get_src().get_value() : -instr.get_src().get_value();
+	return true;
+}
+
+Peephole::Peephole() : m_hits(m_num_rules, 0)
+{
+}
+
+void Peephole::optimize(std::vector<Instruction> &code)
+{
+	std::vector<Instruction> out;
+	out.reserve(code.size());
+	for (auto const &instr : code)
+	{
+		out.push_back(instr);
+		// a rewrite may create a new match at the end of the output
+		bool matched = true;
+		while (matched)
+		{
+			matched = false;
+			for (size_t i = 0; i < m_num_rules && !matched; ++i)
+				if (out.size() >= m_rules[i].window && m_rules[i].apply(out))
+				{
+					++m_hits[i];
+					matched = true;
+				}
+		}
+	}
+	code.swap(out);
+}
+
+void Peephole::print_statistics(std::ostream &os) const
+{
+	os << "Peephole statistics:" << std::endl;
+	for (size_t i = 0; i < m_num_rules; ++i)
+		os << "  " << std::left << std::setw(27) << std::string(m_rules[i].name) + ":" << std::right << m_hits[i] << std::endl;
+}
+
+bool Peephole::mov_self(std::vector<Instruction> &out)
+{
+	Instruction const &mov = out.back();
+	if (mov.get_opcode() != Instruction::MOV || mov.get_src().get_kind() != Operand::REGISTER || mov.get_src() != mov.get_dst())
+		return false;
+	// a 32 bit move clears the upper half of the register
+	if (mov.get_type() == Register::Type::INTEGER && mov.get_size() == 4)
+		return false;
+	out.pop_back();
+	return true;
+}
+
+bool Peephole::push_pop(std::vector<Instruction> &out)
+{
+	Instruction const &push = out[out.size() - 2];
+	Instruction const &pop = out.back();
+	if (push.get_opcode() != Instruction::PUSH || pop.get_opcode() != Instruction::POP ||
+		push.get_src().get_kind() != Operand::REGISTER || pop.get_src().get_kind() != Operand::REGISTER)
+		return false;
+	if (push.get_src() == pop.get_src())
+		out.erase(out.end() - 2, out.end());
+	else
+	{
+		Instruction mov(Instruction::MOV, 8, Register::Type::INTEGER, push.get_src(), pop.get_src());
+		out.erase(out.end() - 2, out.end());
+		out.push_back(mov);
+	}
+	return true;
+}
+
+bool Peephole::stack_adjust(std::vector<Instruction> &out)
+{
+	long long first, second;
+	if (!is_stack_adjust(out[out.size() - 2], first) || !is_stack_adjust(out.back(), second))
+		return false;
+	Instruction merged = out[out.size() - 2];
+	out.erase(out.end() - 2, out.end());
+	long long delta = first + second;
+	if (delta != 0)
+	{
+		Instruction adjust(delta > 0 ? Instruction::ADD : Instruction::SUB, 8, Register::Type::INTEGER,
+						   Operand::immediate(delta > 0 ? delta : -delta), Register(Register::Id::SP));
+		adjust.set_comment(merged.get_comment());
+		out.push_back(adjust);
+	}
+	return true;
+}
+
+bool Peephole::unreachable(std::vector<Instruction> &out)
+{
+	Instruction::Opcode op = out.back().get_opcode();
+	if (op == Instruction::LABEL || op == Instruction::NONE)
+		return false;
+	// comment lines are kept, they do not separate the instruction from the jump
+	size_t i = out.size() - 1;
+	while (i > 0 && out[i - 1].get_opcode() == Instruction::NONE)
+		--i;
+	if (i == 0)
+		return false;
+	op = out[i - 1].get_opcode();
+	if (op != Instruction::JMP && op != Instruction::RET)
+		return false;
+	out.pop_back();
+	return true;
+}
+
+bool Peephole::jmp_next(std::vector<Instruction> &out)
+{
+	Instruction const &label = out.back();
+	if (label.get_opcode() != Instruction::LABEL)
+		return false;
+	// the jump may be followed by other labels of the same place
+	size_t i = out.size() - 1;
+	while (i > 0 && (out[i - 1].get_opcode() == Instruction::LABEL || out[i - 1].get_opcode() == Instruction::NONE))
+		--i;
+	if (i == 0 || out[i - 1].get_opcode() != Instruction::JMP || out[i - 1].get_src() != label.get_src())
+		return false;
+	out.erase(out.begin() + (i - 1));
+	return true;
+}
+
+bool Peephole::store_load(std::vector<Instruction> &out)
+{
+	Instruction const &store = out[out.size() - 2];
+	Instruction &load = out.back();
+	if (store.get_opcode() != Instruction::MOV || load.get_opcode() != Instruction::MOV ||
+		store.get_src().get_kind() != Operand::REGISTER || load.get_dst().get_kind() != Operand::REGISTER)
+		return false;
+	// only the stack slots of variables are forwarded
+	Operand const &slot = store.get_dst();
+	if (slot.get_kind() != Operand::MEMORY || slot.get_base() != Register::Id::BP ||
+		slot.get_index() != Register::Id::NO_REGISTER || load.get_src() != slot)
+		return false;
+	if (store.get_size() != load.get_size() || store.get_type() != load.get_type())
+		return false;
+	Instruction mov(Instruction::MOV, load.get_size(), load.get_type(), store.get_src(), load.get_dst());
+	mov.set_comment(load.get_comment());
+	load = mov;
+	return true;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file peephole.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::Peephole
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PEEPHOLE_H_INCLUDED
+#define PEEPHOLE_H_INCLUDED
+
+#include "instruction.h"
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief Peephole optimizer of the instructions of a function
+ *
+ * @details The instructions are moved to the output one by one, and the rules
+ * of a table are matched against the last few instructions of the output
+ * after each move. A rule rewrites or removes the instructions of its window,
+ * and the rules are tried again until none of them matches, so that the
+ * result of a rewrite is optimized further.
+ */
+class Peephole
+{
+public:
+	/** @brief Construct an optimizer without hits */
+	Peephole();
+
+	/** @brief Optimize the instructions of a function in place */
+	void optimize(std::vector<Instruction> &code);
+
+	/** @brief Print the number of hits of each rule */
+	void print_statistics(std::ostream &os) const;
+
+private:
+	/** @brief rewrite rule matching the end of the output */
+	struct Rule
+	{
+		/** @brief the name of the rule in the statistics */
+		char const *name;
+		/** @brief the minimal number of instructions matched by the rule */
+		size_t window;
+		/** @brief rewrite the end of the output if the rule matches, and return if it did */
+		bool (*apply)(std::vector<Instruction> &out);
+	};
+
+	static bool mov_self(std::vector<Instruction> &out);
+	static bool push_pop(std::vector<Instruction> &out);
+	static bool stack_adjust(std::vector<Instruction> &out);
+	static bool unreachable(std::vector<Instruction> &out);
+	static bool jmp_next(std::vector<Instruction> &out);
+	static bool store_load(std::vector<Instruction> &out);
+
+	/** @brief the rules, tried in this order */
+	static Rule const m_rules[];
+	static size_t const m_num_rules;
+
+	/** @brief the number of rewrites of each rule */
+	std::vector<size_t> m_hits;
+};
+
+#endif
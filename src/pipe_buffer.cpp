@@ -0,0 +1,81 @@
+#include "pipe_buffer.h"
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#else
+#include <csignal>
+#endif
+
+bool PipeBuffer::open(std::string const &command)
+{
+	close();
+#ifndef _WIN32
+	// a command exiting before reading all its input makes the writes fail instead of killing the compiler
+	std::signal(SIGPIPE, SIG_IGN);
+#endif
+	m_pipe = popen(command.c_str(), "w");
+	m_failed = false;
+	return m_pipe != nullptr;
+}
+
+bool PipeBuffer::close()
+{
+	if (m_pipe == nullptr)
+		return false;
+	bool ok = std::fflush(m_pipe) == 0 && !m_failed;
+	ok = pclose(m_pipe) == 0 && ok;
+	m_pipe = nullptr;
+	return ok;
+}
+
+void PipeBuffer::abort()
+{
+	if (m_pipe == nullptr)
+		return;
+	m_failed = true;
+	// the input cannot be taken back, but an error directive at its end prevents writing the object
+	std::fputs("\n\t.err\n", m_pipe);
+	pclose(m_pipe);
+	m_pipe = nullptr;
+}
+
+std::string PipeBuffer::quote(std::string const &arg)
+{
+#ifdef _WIN32
+	return '"' + arg + '"';
+#else
+	std::string quoted(1, '\'');
+	for (char ch : arg)
+		if (ch == '\'')
+			quoted += "'\\''";
+		else
+			quoted += ch;
+	return quoted + '\'';
+#endif
+}
+
+PipeBuffer::int_type PipeBuffer::overflow(int_type ch)
+{
+	if (traits_type::eq_int_type(ch, traits_type::eof()))
+		return traits_type::not_eof(ch);
+	char c = traits_type::to_char_type(ch);
+	return xsputn(&c, 1) == 1 ? ch : traits_type::eof();
+}
+
+std::streamsize PipeBuffer::xsputn(char const *s, std::streamsize n)
+{
+	if (m_pipe == nullptr || m_failed)
+		return 0;
+	std::streamsize written = std::fwrite(s, 1, n, m_pipe);
+	if (written != n)
+		m_failed = true;
+	return written;
+}
+
+int PipeBuffer::sync()
+{
+	if (m_pipe == nullptr || m_failed || std::fflush(m_pipe) != 0)
+		return -1;
+	return 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file pipe_buffer.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::PipeBuffer
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PIPE_BUFFER_H_INCLUDED
+#define PIPE_BUFFER_H_INCLUDED
+
+#include <cstdio>
+#include <streambuf>
+#include <string>
+
+/**
+ * @brief Stream buffer writing into the standard input of a command
+ *
+ * @details The command is started by open() and runs in parallel with the
+ * writer, reading the output as it is handed over by the stream. close()
+ * waits for the command to finish. A command exiting early does not stop
+ * the writer, the failure is reported by close(). A buffer destroyed
+ * without close() makes the assembler reading it fail, so that the output
+ * of a failed compilation is not assembled.
+ */
+class PipeBuffer : public std::streambuf
+{
+public:
+	PipeBuffer() : m_pipe(nullptr), m_failed(false) {}
+
+	/** @brief Abort the command if it is still running */
+	~PipeBuffer() { abort(); }
+
+	PipeBuffer(PipeBuffer const &other) = delete;
+
+	PipeBuffer const &operator=(PipeBuffer const &other) = delete;
+
+	/**
+	 * @brief Start a command reading from the buffer
+	 *
+	 * @param command the command line run by the shell
+	 * @return false if the command cannot be started
+	 */
+	bool open(std::string const &command);
+
+	/**
+	 * @brief Close the standard input of the command and wait for it
+	 *
+	 * @return true if all the output was written and the command succeeded
+	 */
+	bool close();
+
+	/** @brief Mark the output as failed, make the assembler reading it stop with an error, and wait for it */
+	void abort();
+
+	/** @brief Quote an argument of a shell command line */
+	static std::string quote(std::string const &arg);
+
+protected:
+	int_type overflow(int_type ch) override;
+
+	std::streamsize xsputn(char const *s, std::streamsize n) override;
+
+	int sync() override;
+
+private:
+	std::FILE *m_pipe;
+	bool m_failed; ///< a write has failed, the command has probably exited
+};
+
+#endif
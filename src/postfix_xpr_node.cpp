@@ -144,7 +144,7 @@ bool PostfixXprNode::type_check_impl()
 		Type const *member_type = structure_type.lookup_structure_field_type(field_name);
 		if (member_type == nullptr)
 		{
-			std::cerr << "Could not find field member " + field_name + " in structure type";
+			std::cerr << "Could not find field member " << field_name << " in structure type";
 			return false;
 		}
 		second_xpr->set_xpr_type(*member_type);
@@ -168,7 +168,7 @@ bool PostfixXprNode::type_check_impl()
 		Type const *member_type = structure_type.lookup_structure_field_type(field_name);
 		if (member_type == nullptr)
 		{
-			std::cerr << "Could not find field member " + field_name + " in structure type";
+			std::cerr << "Could not find field member " << field_name << " in structure type";
 			return false;
 		}
 		second_xpr->set_xpr_type(*member_type);
@@ -15,7 +15,7 @@ public:
 
 	XprNode *clone() override
 	{
-		PostfixXprNode *c = new PostfixXprNode(*this);
+		PostfixXprNode *c = create<PostfixXprNode>(*this);
 		for (size_t i = 0; i < get_num_subxprs(); ++i)
 			c->set_subxpr(i, get_subxpr(i)->clone());
 		return c;
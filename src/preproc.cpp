@@ -1,34 +1,85 @@
 #include "preproc.h"
 
-void Preprocessor::process(char const *fname, char const *prepname)
+#include <algorithm>
+#include <filesystem>
+
+std::array<Preprocessor::lexer_fptr, 256> const Preprocessor::m_lexers = Preprocessor::make_lexer_table();
+std::array<Preprocessor::BinaryOperator, PreprocToken::N_PUNCTUATORS> const Preprocessor::m_binary_operators =
+	Preprocessor::make_operator_table();
+
+void Preprocessor::process(char const *fname)
 {
 	m_write = true;
-	m_pp_token_list = tokenize(fname);
-	m_current_token = m_pp_token_list.begin();
-	m_end = m_pp_token_list.end();
-	m_ofs = std::ofstream(prepname);
+	m_output.clear();
+	SourceFile &file = load_file(fname);
+	file.included = true;
+	m_sources.assign(1, Source{&file, 0});
+	read_line();
 
 	parse_preprocessing_file();
 }
 
-bool Preprocessor::is_white_space(char s)
+void Preprocessor::print_text(std::ostream &os) const
 {
-	char white_spaces[] = {' ', '\t', '\0'}; // the last item terminates the array
-	for (size_t i = 0; white_spaces[i] != '\0'; ++i)
-		if (s == white_spaces[i])
-			return true;
-	return false;
+	for (auto const &pt : m_output)
+		os << pt.get_string();
+}
+
+void Preprocessor::print_dependencies(std::ostream &os, std::string const &target) const
+{
+	// blanks and comment signs are escaped, dollar signs doubled and long rules are continued on the next line, as make expects
+	auto escape = [](std::string const &name) {
+		std::string escaped;
+		for (char c : name)
+		{
+			if (c == ' ' || c == '\t' || c == '#')
+				escaped += '\\';
+			else if (c == '$')
+				escaped += '$';
+			escaped += c;
+		}
+		return escaped;
+	};
+
+	std::string line = escape(target) + ":";
+	for (auto const &dep : m_dependencies)
+	{
+		std::string name = escape(dep);
+		if (line.size() + 1 + name.size() > 78)
+		{
+			os << line << " \\" << std::endl;
+			line = " ";
+		}
+		line += " " + name;
+	}
+	os << line << std::endl;
+}
+
+void Preprocessor::print_statistics(std::ostream &os) const
+{
+	os << "Preprocessor statistics:" << std::endl
+	   << "  includes processed:  " << m_stats.includes << std::endl
+	   << "  files read:          " << m_stats.files_read << std::endl
+	   << "  files mapped:        " << m_stats.files_mapped << std::endl
+	   << "  token cache hits:    " << m_stats.cache_hits << std::endl
+	   << "  includes skipped:    " << m_stats.skipped << std::endl
+	   << "  bytes skipped:       " << m_stats.bytes_skipped << std::endl
+	   << "  lines tokenized:     " << m_stats.lines_tokenized << std::endl
+	   << "  group bytes skipped: " << m_stats.group_bytes << std::endl
+	   << "  macro expansions:    " << m_stats.expansions << std::endl
+	   << "  expansion hits:      " << m_stats.expansion_hits << std::endl
+	   << "  include lookups:     " << m_stats.lookups << std::endl
+	   << "  lookup cache hits:   " << m_stats.lookup_hits << std::endl
+	   << "  file system probes:  " << m_stats.probes << std::endl;
 }
 
 char const *Preprocessor::lex_white_space_sequence(char const *s, PreprocToken *pt)
 {
 	if (!is_white_space(*s))
 		return s;
-	char const *end = s;
-	while (is_white_space(*end))
-		end++;
+	char const *end = CharScan::skip_blanks(s);
 	pt->set_category(PreprocToken::WHITE_SPACE_SEQUENCE);
-	pt->set_string(std::string(s, end));
+	pt->set_string(std::string_view(s, end - s));
 	return end;
 }
 
@@ -43,9 +94,8 @@ char const *Preprocessor::lex_header_name_impl(char const *s, PreprocToken *pt,
 	if (*end == '\n')
 		return s;
 	end++;
-	std::string str(s, end);
 	pt->set_category(PreprocToken::HEADER_NAME);
-	pt->set_string(str);
+	pt->set_string(std::string_view(s, end - s));
 	return end;
 }
 
@@ -64,55 +114,55 @@ char const *Preprocessor::lex_identifier(char const *str, PreprocToken *pt)
 	char const *end = str;
 	if (!is_identifier_nondigit(*end))
 		return str;
-	end++;
-	while (is_identifier(*end))
-		end++;
+	end = CharScan::skip_identifier(end + 1);
 	pt->set_category(PreprocToken::IDENTIFIER);
-	pt->set_string(std::string(str, end));
+	pt->set_string(std::string_view(str, end - str));
 	return end;
 }
 
 char const *Preprocessor::lex_pp_number(char const *str, PreprocToken *pt)
 {
 	char const *end = str;
-	if (!isdigit(*end) && !(*end == '.' && isdigit(*(end + 1))))
+	if (!CharScan::is_digit(*end) && !(*end == '.' && CharScan::is_digit(*(end + 1))))
 		return str;
 	if (*end == '.')
 		end++;
 	while (true)
 	{
-		if (isdigit(*end))
+		if (CharScan::is_digit(*end))
 			end++;
 		else if (*end == '.')
 			end++;
 		else if ((*end == 'e' || *end == 'E' || *end == 'p' || *end == 'P') && (*(end + 1) == '+' || *(end + 1) == '-'))
 			end += 2;
-		else if (isalpha(*end) || *end == '_')
+		else if (is_identifier_nondigit(*end))
 			end++;
 		else
 			break;
 	}
 	pt->set_category(PreprocToken::PP_NUMBER);
-	pt->set_string(std::string(str, end));
+	pt->set_string(std::string_view(str, end - str));
 	return end;
 }
 
 char const *Preprocessor::lex_string_literal(char const *str, PreprocToken *pt)
 {
 	char const *end = str;
-	// string literal
-	if (*end == '\"')
+	if (*end != '\"')
+		return str;
+	end = CharScan::find_quote_end(end + 1, '"');
+	while (*end != '"')
 	{
-		end++;
-		while (*end != '\"')
-			end++;
-		end++;
-		std::string data(str + 1, end - 1);
-		pt->set_category(PreprocToken::STRING_LITERAL);
-		pt->set_string(data);
-		return end;
+		if (*end == '\n' || *end == '\0')
+			return str; // unterminated
+		if (end[1] != '\n' && end[1] != '\0')
+			end++; // skip escaped character
+		end = CharScan::find_quote_end(end + 1, '"');
 	}
-	return str;
+	end++;
+	pt->set_category(PreprocToken::STRING_LITERAL);
+	pt->set_string(std::string_view(str, end - str)); // quotes are kept
+	return end;
 }
 
 char const *Preprocessor::lex_c_char(char const *str)
@@ -120,7 +170,7 @@ char const *Preprocessor::lex_c_char(char const *str)
 	if (str[0] == '\\')
 	{
 		// try lexing simple escape sequence
-		char simple[] = {'\\', '\"', '?', '\\', 'a', 'b', 'f', 'n', 'r', 't', 'v', '0'};
+		char simple[] = {'\'', '\"', '?', '\\', 'a', 'b', 'f', 'n', 'r', 't', 'v', '0'};
 		for (size_t i = 0; i < sizeof simple; ++i)
 			if (str[1] == simple[i])
 				return str + 2;
@@ -133,7 +183,7 @@ char const *Preprocessor::lex_c_char(char const *str)
 		if (str[1] == 'x')
 		{
 			size_t i = 0;
-			while (isxdigit(str[2 + i]))
+			while (CharScan::is_xdigit(str[2 + i]))
 				i++;
 			if (i > 0)
 				return str + 2 + i;
@@ -142,7 +192,7 @@ char const *Preprocessor::lex_c_char(char const *str)
 		return str;
 	}
 	// plain character
-	if (str[0] != '\n' && str[0] != '\\' && str[0] != '\'')
+	if (str[0] != '\n' && str[0] != '\0' && str[0] != '\\' && str[0] != '\'')
 		return str + 1;
 	// could not lex
 	return str;
@@ -157,11 +207,16 @@ char const *Preprocessor::lex_character_constant(char const *str, PreprocToken *
 	{
 		end++;
 		while (*end != '\'')
-			end = lex_c_char(end);
+		{
+			// an unterminated constant is not lexed, its quote becomes a single character token
+			char const *next = lex_c_char(end);
+			if (next == end)
+				return str;
+			end = next;
+		}
 		end++; // skip closing '
-		std::string data(str, end);
 		pt->set_category(PreprocToken::CHARACTER_CONSTANT);
-		pt->set_string(data);
+		pt->set_string(std::string_view(str, end - str));
 		return end;
 	}
 	return str;
@@ -196,10 +251,8 @@ char const *Preprocessor::lex_block_comment(char const *str, PreprocToken *pt)
 {
 	if (str[0] == '/' && str[1] == '*')
 	{
-		char const *end = str + 2;
-		while (end[0] != '*' || end[1] != '/')
-			end++;
-		end += 2;
+		char const *end = CharScan::find_comment_end(str + 2);
+		end += *end == '\0' ? 0 : 2; // unterminated comments end with the text
 		pt->set_category(PreprocToken::WHITE_SPACE_SEQUENCE);
 		pt->set_string(" ");
 		return end;
@@ -209,73 +262,136 @@ char const *Preprocessor::lex_block_comment(char const *str, PreprocToken *pt)
 
 char const *Preprocessor::lex_punctuator(char const *str, PreprocToken *pt)
 {
-	char const *puncts[] = {"...", ">>=", "<<=", "^=", "|=", "&=", "+=", "-=",
-							"*=", "/=", "%=", "||", "&&", "==", "!=", "<<",
-							">>", "<=", ">=", "++", "--", "->", ";", "(", ")",
-							"{", "}", "+", "-", "*", "=", "%", "/", "<", ">",
-							"&", "|", "^", "~", ",", "[", "]", ".", "?", ":", "!",
-							"##", "#",
-							nullptr};
-	for (int i = 0; puncts[i] != nullptr; i++)
-	{
-		size_t n = strlen(puncts[i]);
-		if (strncmp(str, puncts[i], n) == 0)
+	// longer punctuators precede their prefixes
+	struct
+	{
+		char const *str;
+		PreprocToken::Punctuator code;
+	} const puncts[] = {
+		{"...", PreprocToken::ELLIPSIS}, {">>=", PreprocToken::RIGHT_ASSIGN}, {"<<=", PreprocToken::LEFT_ASSIGN},
+		{"^=", PreprocToken::XOR_ASSIGN}, {"|=", PreprocToken::OR_ASSIGN}, {"&=", PreprocToken::AND_ASSIGN},
+		{"+=", PreprocToken::ADD_ASSIGN}, {"-=", PreprocToken::SUB_ASSIGN}, {"*=", PreprocToken::MUL_ASSIGN},
+		{"/=", PreprocToken::DIV_ASSIGN}, {"%=", PreprocToken::MOD_ASSIGN}, {"||", PreprocToken::LOGICAL_OR},
+		{"&&", PreprocToken::LOGICAL_AND}, {"==", PreprocToken::EQUAL}, {"!=", PreprocToken::NOT_EQUAL},
+		{"<<", PreprocToken::LEFT_SHIFT}, {">>", PreprocToken::RIGHT_SHIFT}, {"<=", PreprocToken::LESS_EQUAL},
+		{">=", PreprocToken::GREATER_EQUAL}, {"++", PreprocToken::INCREMENT}, {"--", PreprocToken::DECREMENT},
+		{"->", PreprocToken::ARROW}, {";", PreprocToken::SEMICOLON}, {"(", PreprocToken::LEFT_PAREN},
+		{")", PreprocToken::RIGHT_PAREN}, {"{", PreprocToken::LEFT_BRACE}, {"}", PreprocToken::RIGHT_BRACE},
+		{"+", PreprocToken::PLUS}, {"-", PreprocToken::MINUS}, {"*", PreprocToken::ASTERISK},
+		{"=", PreprocToken::ASSIGN}, {"%", PreprocToken::PERCENT}, {"/", PreprocToken::SLASH},
+		{"<", PreprocToken::LESS}, {">", PreprocToken::GREATER}, {"&", PreprocToken::AMPERSAND},
+		{"|", PreprocToken::BAR}, {"^", PreprocToken::CARET}, {"~", PreprocToken::TILDE},
+		{",", PreprocToken::COMMA}, {"[", PreprocToken::LEFT_BRACKET}, {"]", PreprocToken::RIGHT_BRACKET},
+		{".", PreprocToken::DOT}, {"?", PreprocToken::QUESTION}, {":", PreprocToken::COLON},
+		{"!", PreprocToken::EXCLAMATION}, {"##", PreprocToken::HASH_HASH}, {"#", PreprocToken::HASH},
+		{nullptr, PreprocToken::NOT_PUNCTUATOR}};
+	for (int i = 0; puncts[i].str != nullptr; i++)
+	{
+		if (puncts[i].str[0] != str[0])
+			continue;
+		size_t n = strlen(puncts[i].str);
+		if (strncmp(str, puncts[i].str, n) == 0)
 		{
 			pt->set_category(PreprocToken::PUNCTUATOR);
-			pt->set_string(std::string(str, str + n));
+			pt->set_punctuator(puncts[i].code);
+			pt->set_string(std::string_view(str, n));
 			return str + n;
 		}
 	}
 	return str;
 }
 
-std::list<PreprocToken> Preprocessor::tokenize(char const *fname)
-{
-	// read the whole file into a string
-	std::ifstream ifs(fname);
-	std::string str((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
-	ifs.close();
-
-	// remove '\'+'\n' sequences
-	size_t where = 0;
-	while ((where = str.find("\\\n", where)) != std::string::npos)
-		str.erase(where, 2);
-
-	// split into list of pp-tokens
-	std::list<PreprocToken> pp_token_list;
-	using lexer_fptr = char const *(*)(char const *, PreprocToken *);
-	lexer_fptr lexer_funs[] = {
-		lex_white_space_sequence,
-		lex_h_header_name,
-		lex_q_header_name,
-		lex_identifier,
-		lex_pp_number,
-		lex_string_literal,
-		lex_character_constant,
-		lex_new_line,
-		lex_line_comment,
-		lex_block_comment,
-		lex_punctuator,
-		nullptr};
-
-	char const *s = str.c_str();
-	while (*s != '\0')
-	{
-		bool lexed = false;
-		for (size_t i = 0; lexer_funs[i] != nullptr; ++i)
+char const *Preprocessor::lex_slash(char const *str, PreprocToken *pt)
+{
+	char const *end;
+	if ((end = lex_line_comment(str, pt)) != str)
+		return end;
+	if ((end = lex_block_comment(str, pt)) != str)
+		return end;
+	return lex_punctuator(str, pt);
+}
+
+char const *Preprocessor::lex_dot(char const *str, PreprocToken *pt)
+{
+	char const *end;
+	if ((end = lex_pp_number(str, pt)) != str)
+		return end;
+	return lex_punctuator(str, pt);
+}
+
+std::array<Preprocessor::lexer_fptr, 256> Preprocessor::make_lexer_table()
+{
+	std::array<lexer_fptr, 256> table{};
+	for (int c = 0; c < 256; ++c)
+	{
+		if (is_white_space(c))
+			table[c] = lex_white_space_sequence;
+		else if (is_identifier_nondigit(c))
+			table[c] = lex_identifier; // also L'x', the prefix is lexed as an identifier
+		else if (CharScan::is_digit(c))
+			table[c] = lex_pp_number;
+	}
+	for (char c : std::string(";(){}+-*=%<>&|^~,[]?:!#"))
+		table[static_cast<unsigned char>(c)] = lex_punctuator;
+	table['\n'] = lex_new_line;
+	table['"'] = lex_string_literal;
+	table['\''] = lex_character_constant;
+	table['/'] = lex_slash;
+	table['.'] = lex_dot;
+	return table;
+}
+
+bool Preprocessor::is_include_directive(std::vector<PreprocToken> const &line)
+{
+	auto it = line.rbegin();
+	while (it != line.rend() && it->is_white_space())
+		it++;
+	if (it == line.rend() || it->get_string() != "include")
+		return false;
+	it++;
+	while (it != line.rend() && it->is_white_space())
+		it++;
+	if (it == line.rend() || it->get_string() != "#")
+		return false;
+	it++;
+	while (it != line.rend() && it->is_white_space())
+		it++;
+	return it == line.rend() || it->get_category() == PreprocToken::NEW_LINE;
+}
+
+size_t Preprocessor::tokenize(SourceFile const &file, size_t pos, std::vector<PreprocToken> *line)
+{
+	// split into pp-tokens until the end of the line
+	std::vector<PreprocToken> &pp_token_list = *line;
+	char const *text = file.text.data();
+	char const *s = text + pos;
+	// the physical line of the current token, tracked forward from pos
+	auto ls = std::upper_bound(file.line_starts.begin(), file.line_starts.end(), pos) - 1;
+
+	while (*s != '\0' && (pp_token_list.empty() || pp_token_list.back().get_category() != PreprocToken::NEW_LINE))
+	{
+		PreprocToken pt;
+		size_t offset = s - text;
+		while (ls + 1 != file.line_starts.end() && *(ls + 1) <= offset)
+			++ls;
+		pt.set_coordinate(Coordinate(ls - file.line_starts.begin() + 1, offset - *ls + 1));
+		char const *end = s;
+		// header names are only recognized in include directives, elsewhere < is an operator
+		if ((*s == '<' || *s == '"') && is_include_directive(pp_token_list))
+			end = *s == '<' ? lex_h_header_name(s, &pt) : lex_q_header_name(s, &pt);
+		// the first character selects the only lexer that can match
+		lexer_fptr lexer = m_lexers[static_cast<unsigned char>(*s)];
+		if (end == s && lexer != nullptr)
+			end = lexer(s, &pt);
+		if (end == s)
 		{
-			PreprocToken pt;
-			char const *end;
-			if ((end = lexer_funs[i](s, &pt)) != s)
-			{
-				s = end;
-				pp_token_list.push_back(pt);
-				lexed = true;
-				break;
-			}
+			// each non-white-space character that cannot start another token is a token itself
+			pt.set_category(PreprocToken::OTHER);
+			pt.set_string(std::string_view(s, 1));
+			end = s + 1;
 		}
-		if (!lexed)
-			throw __FILE__ ": unprocessed preprocessor token.";
+		s = end;
+		pp_token_list.push_back(std::move(pt));
 	}
 
 	// insert newline character to end if needed
@@ -283,10 +399,313 @@ std::list<PreprocToken> Preprocessor::tokenize(char const *fname)
 	{
 		PreprocToken pt;
 		pt.set_category(PreprocToken::NEW_LINE);
+		pt.set_string("\n");
+		pt.set_coordinate(Coordinate(ls - file.line_starts.begin() + 1, s - text - *ls + 1));
 		pp_token_list.push_back(pt);
 	}
 
-	return pp_token_list;
+	return s - text;
+}
+
+void Preprocessor::read_line()
+{
+	m_pp_token_list.clear();
+	while (!m_sources.empty())
+	{
+		Source &src = m_sources.back();
+		// text lines do not affect the directives, they are not even tokenized when scanning
+		if (m_scan_only)
+			src.pos = find_directive(src.file->text, src.pos, nullptr);
+		if (src.pos < src.file->text.size())
+			break;
+		m_sources.pop_back();
+	}
+	if (m_sources.empty())
+	{
+		m_current_token = m_pp_token_list.end();
+		return;
+	}
+
+	Source &src = m_sources.back();
+	auto it = src.file->lines.find(src.pos);
+	if (it == src.file->lines.end())
+	{
+		SourceFile::Line line;
+		line.next = tokenize(*src.file, src.pos, &line.tokens);
+		it = src.file->lines.emplace(src.pos, std::move(line)).first;
+		m_stats.lines_tokenized++;
+	}
+	m_pp_token_list.assign(it->second.tokens.begin(), it->second.tokens.end());
+	m_current_token = m_pp_token_list.begin();
+	src.pos = it->second.next;
+}
+
+Preprocessor::SourceFile &Preprocessor::load_file(std::string const &fname)
+{
+	auto it = m_files.find(fname);
+	if (it != m_files.end())
+	{
+		m_stats.cache_hits++;
+		return it->second;
+	}
+	SourceFile &file = m_files[fname];
+	m_dependencies.push_back(fname);
+	size_t slash = fname.rfind('/');
+	if (slash != std::string::npos)
+		file.dir = fname.substr(0, slash);
+
+	// map or read the whole file, a file that cannot be read is empty
+	file.buffer.load(fname);
+	file.size = file.buffer.size();
+	if (file.buffer.is_mapped())
+		m_stats.files_mapped++;
+
+	// remove '\'+'\n' sequences in place in a single pass,
+	// and note where the physical lines start in the spliced text
+	char *text = file.buffer.data();
+	size_t size = file.buffer.size();
+	file.line_starts.assign(1, 0);
+	size_t out = 0;
+	for (size_t in = 0; in < size; ++in)
+	{
+		if (text[in] == '\\' && in + 1 < size && text[in + 1] == '\n')
+		{
+			++in;
+			file.line_starts.push_back(out);
+			continue;
+		}
+		text[out++] = text[in];
+		if (text[in] == '\n')
+			file.line_starts.push_back(out);
+	}
+	if (out != size)
+		file.buffer.truncate(out);
+	file.text = file.buffer.view();
+
+	m_stats.files_read++;
+	return file;
+}
+
+void Preprocessor::add_include_path(std::string const &dir, bool system)
+{
+	std::string path = dir;
+	while (path.size() > 1 && path.back() == '/')
+		path.pop_back();
+	(system ? m_system_paths : m_include_paths).push_back(path);
+}
+
+std::string const &Preprocessor::find_include(std::string const &header, std::string const &dir)
+{
+	m_stats.lookups++;
+	std::string name(header.begin() + 1, header.end() - 1);
+	bool quoted = header[0] == '"';
+	// only quoted names depend on the directory of the including file
+	std::string key = (quoted ? dir : std::string()) + '\n' + header;
+	auto it = m_include_cache.find(key);
+	if (it != m_include_cache.end())
+	{
+		m_stats.lookup_hits++;
+		return it->second;
+	}
+
+	std::string &path = m_include_cache[key];
+	if (name.empty() || name[0] == '/')
+	{
+		if (file_exists(name))
+			path = name;
+		return path;
+	}
+
+	std::vector<std::string const *> dirs;
+	if (quoted)
+		dirs.push_back(&dir);
+	for (auto const &d : m_include_paths)
+		dirs.push_back(&d);
+	for (auto const &d : m_system_paths)
+		dirs.push_back(&d);
+	for (auto d : dirs)
+	{
+		std::string candidate = d->empty() ? name : *d + "/" + name;
+		if (file_exists(candidate))
+		{
+			path = candidate;
+			return path;
+		}
+	}
+	// the current working directory is the last resort
+	if (file_exists(name))
+		path = name;
+	return path;
+}
+
+bool Preprocessor::file_exists(std::string const &path)
+{
+	auto it = m_file_exists.find(path);
+	if (it != m_file_exists.end())
+		return it->second;
+	m_stats.probes++;
+	std::error_code ec;
+	bool exists = std::filesystem::is_regular_file(path, ec);
+	m_file_exists.emplace(path, exists);
+	return exists;
+}
+
+size_t Preprocessor::end_of_line(std::string_view text, size_t pos, bool *blank)
+{
+	char const *s = text.data() + pos;
+	while (true)
+	{
+		// find the next character that may start a comment, a literal, or end the line
+		char const *p = CharScan::find_line_special(s);
+		if (blank != nullptr && *blank)
+			for (char const *q = s; q != p; ++q)
+				if (!is_white_space(*q) && *q != '\r')
+					*blank = false;
+
+		if (*p == '\n')
+			return p + 1 - text.data();
+		if (*p == '\0')
+			return text.size();
+		if (p[0] == '/' && p[1] == '*')
+		{
+			// block comments may span several lines
+			char const *end = CharScan::find_comment_end(p + 2);
+			s = *end == '\0' ? end : end + 2;
+			continue;
+		}
+		if (p[0] == '/' && p[1] == '/')
+		{
+			char const *end = strchr(p, '\n');
+			return end == nullptr ? text.size() : end + 1 - text.data();
+		}
+		if (blank != nullptr)
+			*blank = false;
+		if (*p == '/')
+		{
+			s = p + 1;
+			continue;
+		}
+		// string literal or character constant, terminated at the end of the line
+		char quote = *p;
+		p = CharScan::find_quote_end(p + 1, quote);
+		while (*p == '\\')
+		{
+			if (p[1] != '\n' && p[1] != '\0')
+				p++;
+			p = CharScan::find_quote_end(p + 1, quote);
+		}
+		s = *p == quote ? p + 1 : p;
+	}
+}
+
+size_t Preprocessor::find_directive(std::string_view text, size_t pos, bool *blank)
+{
+	while (pos < text.size())
+	{
+		size_t p = pos;
+		while (is_white_space(text[p]))
+			p++;
+		if (text[p] == '#')
+			return pos;
+		pos = end_of_line(text, pos, blank);
+	}
+	return text.size();
+}
+
+std::string Preprocessor::read_directive(std::string_view text, size_t pos, std::string *arg)
+{
+	char const *s = text.data() + pos;
+	while (is_white_space(*s))
+		s++;
+	s++; // #
+	std::string words[2];
+	for (auto &word : words)
+	{
+		while (is_white_space(*s))
+			s++;
+		char const *end = s;
+		while (is_identifier(*end))
+			end++;
+		word.assign(s, end);
+		s = end;
+	}
+	*arg = words[1];
+	return words[0];
+}
+
+void Preprocessor::detect_include_guard(SourceFile *file)
+{
+	std::string_view text = file->text;
+	std::string guard;
+	int depth = 0;
+	bool closed = false;	// the #endif of the guard has been reached
+	bool guarded = true;	// nothing is found outside the guard yet
+
+	size_t pos = 0;
+	while (pos < text.size())
+	{
+		// only the lines outside the guard need to be checked for contents
+		bool blank = true;
+		pos = find_directive(text, pos, &blank);
+		if (!blank && (depth == 0 || closed))
+			guarded = false;
+		if (pos == text.size())
+			break;
+
+		std::string arg;
+		std::string name = read_directive(text, pos, &arg);
+		pos = end_of_line(text, pos, nullptr);
+		if (closed)
+		{
+			guarded = false;
+			break;
+		}
+
+		if (name == "if" || name == "ifdef" || name == "ifndef")
+		{
+			if (depth == 0)
+			{
+				if (name == "ifndef" && !arg.empty() && guard.empty())
+					guard = arg;
+				else
+					guarded = false;
+			}
+			depth++;
+		}
+		else if (name == "endif")
+		{
+			if (--depth == 0)
+				closed = true;
+		}
+		else if (name == "elif" || name == "else")
+		{
+			if (depth == 1)
+				guarded = false;
+		}
+		else if (depth == 0 && !name.empty())
+		{
+			if (name == "pragma" && arg == "once")
+				file->once = true;
+			else
+				guarded = false;
+		}
+	}
+
+	if (guarded && closed)
+		file->guard = guard;
+	file->analyzed = true;
+}
+
+bool Preprocessor::is_skippable(SourceFile &file) const
+{
+	if (!file.included)
+		return false;
+	// guards only matter for files included more than once, they are detected on demand
+	if (!file.analyzed)
+		detect_include_guard(&file);
+	if (file.once)
+		return true;
+	return !file.guard.empty() && is_defined(file.guard);
 }
 
 bool Preprocessor::parse_group_part()
@@ -351,34 +770,27 @@ bool Preprocessor::parse_if_group(int *cond)
 		int result;
 		parse_constant_expression(&result);
 		m_write = m_write && result;
-		parse_new_line();
-		m_write = m_write && result;
-		while (!is_elif_group() && !is_else_group() && !is_endif_line())
-			parse_group_part();
+		parse_group();
 		*cond = result;
 	}
 	else if (m_current_token->get_string() == "ifdef")
 	{
 		next_token();
-		std::string identifier = m_current_token->get_string();
+		std::string_view identifier = m_current_token->get_string();
 		next_token();
-		parse_new_line();
 		int result = is_defined(identifier);
 		m_write = m_write && result;
-		while (!is_elif_group() && !is_else_group() && !is_endif_line())
-			parse_group_part();
+		parse_group();
 		*cond = result;
 	}
 	else if (m_current_token->get_string() == "ifndef")
 	{
 		next_token();
-		std::string identifier = m_current_token->get_string();
+		std::string_view identifier = m_current_token->get_string();
 		next_token();
-		parse_new_line();
 		int result = !is_defined(identifier);
 		m_write = m_write && result;
-		while (!is_elif_group() && !is_else_group() && !is_endif_line())
-			parse_group_part();
+		parse_group();
 		*cond = result;
 	}
 	else
@@ -407,10 +819,8 @@ bool Preprocessor::parse_elif_group(int *cond)
 	int result;
 	parse_constant_expression(&result);
 	m_write = m_write && result;
-	parse_new_line();
-	while (!is_elif_group() && !is_else_group() && !is_endif_line())
-		if (!parse_group_part())
-			return false;
+	if (!parse_group())
+		return false;
 	*cond = result;
 	return true;
 }
@@ -433,12 +843,62 @@ bool Preprocessor::parse_else_group()
 	skip_white_spaces();
 	next_token(); // #
 	next_token(); // else
+	return parse_group();
+}
+
+bool Preprocessor::parse_group()
+{
+	// the new line of the directive is the current token
+	skip_white_spaces();
+	if (!m_write)
+		return skip_group();
 	parse_new_line();
-	while (!is_endif_line())
-		parse_group_part();
+	while (!is_elif_group() && !is_else_group() && !is_endif_line())
+		if (!parse_group_part())
+			return false;
 	return true;
 }
 
+bool Preprocessor::skip_group()
+{
+	int depth = 0;
+	while (!m_sources.empty())
+	{
+		// jump to the next directive of the file, the lines before it are not tokenized
+		Source &src = m_sources.back();
+		size_t pos = find_directive(src.file->text, src.pos, nullptr);
+		std::string name, arg;
+		if (pos < src.file->text.size())
+			name = read_directive(src.file->text, pos, &arg);
+		// only the conditional directives are tokenized, the others are skipped like the text lines
+		if (!name.empty() && name != "if" && name != "ifdef" && name != "ifndef" && name != "elif" &&
+			name != "else" && name != "endif")
+		{
+			size_t next = end_of_line(src.file->text, pos, nullptr);
+			m_stats.group_bytes += next - src.pos;
+			src.pos = next;
+			continue;
+		}
+		m_stats.group_bytes += pos - src.pos;
+		src.pos = pos;
+		read_line();
+		if (m_current_token == m_pp_token_list.end())
+			break;
+
+		// check if the directive ends the group
+		if (is_if_section())
+			depth++;
+		else if (is_elif_group() || is_else_group() || is_endif_line())
+		{
+			if (depth == 0)
+				return true;
+			if (is_endif_line())
+				depth--;
+		}
+	}
+	return false;
+}
+
 bool Preprocessor::is_endif_line() const
 {
 	auto iter = m_current_token;
@@ -482,22 +942,22 @@ bool Preprocessor::parse_control_line()
 	if (m_current_token->get_string() == "define")
 	{
 		next_token();
-		std::string const &identifier = m_current_token->get_string();
-		if (m_write)
-			add_macro(identifier);
+		std::string_view identifier = m_current_token->get_string();
 		next_token();
+		std::vector<PreprocToken> replacement;
 		while (m_current_token->get_category() != PreprocToken::NEW_LINE)
 		{
-			if (m_write)
-				add_macro_replacement(identifier, *m_current_token);
+			replacement.push_back(*m_current_token);
 			next_token();
 		}
+		if (m_write)
+			add_macro(identifier, std::move(replacement));
 		next_token(); // skip newline
 	}
 	else if (m_current_token->get_string() == "undef")
 	{
 		next_token();
-		std::string const &identifier = m_current_token->get_string();
+		std::string_view identifier = m_current_token->get_string();
 		next_token();
 		if (m_write)
 			remove_macro(identifier);
@@ -506,18 +966,32 @@ bool Preprocessor::parse_control_line()
 	else if (m_current_token->get_string() == "include")
 	{
 		next_token();
-		std::string headername = m_current_token->get_string();
+		std::string headername(m_current_token->get_string());
 		next_token();
 		skip_white_spaces();
 		// now we are at the new line after the include
 		// paste the content after the new line
 		if (m_write)
 		{
-			std::string fname(headername.begin() + 1, headername.end() - 1);
-			std::list<PreprocToken> include_content = this->tokenize(fname.c_str());
-			auto pos = m_current_token;
-			pos++;
-			m_pp_token_list.insert(pos, include_content.begin(), include_content.end());
+			m_stats.includes++;
+			std::string const &fname = find_include(headername, m_sources.back().file->dir);
+			if (fname.empty())
+			{
+				std::cerr << "Cannot find include file " << headername << std::endl;
+				throw __FILE__ ": include file not found";
+			}
+			SourceFile &file = load_file(fname);
+			if (is_skippable(file))
+			{
+				m_stats.skipped++;
+				m_stats.bytes_skipped += file.size;
+			}
+			else
+			{
+				// the lines of the file follow the new line of the directive
+				file.included = true;
+				m_sources.push_back(Source{&file, 0});
+			}
 		}
 
 		parse_new_line();
@@ -534,25 +1008,23 @@ bool Preprocessor::parse_text_line()
 		if (m_write)
 		{
 			// lookup identifiers in marco table
-			if (m_current_token->get_category() == PreprocToken::IDENTIFIER)
+			if (m_current_token->get_category() == PreprocToken::IDENTIFIER
+				&& is_defined(m_current_token->get_string()))
 			{
-				std::string const &id = m_current_token->get_string();
-				if (is_defined(id))
-				{
-					std::list<PreprocToken> replace = macro_substitute(id);
-					for (auto j : replace)
-						m_ofs << j.get_string();
-				}
-				else
-					m_ofs << id;
+				std::vector<PreprocToken> const &replace = macro_substitute(m_current_token->get_string());
+				size_t first = m_output.size();
+				m_output.insert(m_output.end(), replace.begin(), replace.end());
+				// the expanded tokens are reported at the position of the macro name
+				for (size_t i = first; i < m_output.size(); ++i)
+					m_output[i].set_coordinate(m_current_token->get_coordinate());
 			}
-			else
-				m_ofs << m_current_token->get_string();
+			else // the token is not visited again, its content can be moved
+				m_output.push_back(std::move(*m_current_token));
 		}
 		next_token(false);
 	}
-	next_token(false); // newline token
-	m_ofs << std::endl;
+	m_output.push_back(*m_current_token); // newline token
+	next_token(false);
 
 	return true;
 }
@@ -586,87 +1058,166 @@ bool Preprocessor::parse_new_line()
 	return false;
 }
 
-std::list<PreprocToken> Preprocessor::macro_substitute(std::string const &id) const
+void Preprocessor::add_macro(std::string_view id, std::vector<PreprocToken> replacement)
+{
+	invalidate_expansions(id);
+	Macro &macro = m_macros[id];
+	macro = Macro();
+	macro.replacement = std::move(replacement);
+}
+
+void Preprocessor::remove_macro(std::string_view id)
+{
+	invalidate_expansions(id);
+	m_macros.erase(id);
+}
+
+void Preprocessor::invalidate_expansions(std::string_view id)
+{
+	auto it = m_dependents.find(id);
+	if (it == m_dependents.end())
+		return;
+	// the dependencies are transitive, so the dependents of the dependents are in the set too
+	std::unordered_set<std::string_view> dependents = std::move(it->second);
+	m_dependents.erase(it);
+	for (std::string_view dependent : dependents)
+	{
+		auto m = m_macros.find(dependent);
+		if (m == m_macros.end() || !m->second.expanded)
+			continue;
+		// the dropped expansion is not registered at its other dependencies either
+		for (std::string_view dep : m->second.dependencies)
+		{
+			auto d = m_dependents.find(dep);
+			if (d != m_dependents.end() && d->second.erase(dependent) != 0 && d->second.empty())
+				m_dependents.erase(d);
+		}
+		m->second.expanded = false;
+		m->second.expansion.clear();
+		m->second.dependencies.clear();
+	}
+}
+
+std::vector<PreprocToken> const &Preprocessor::macro_substitute(std::string_view id)
 {
 	auto it = m_macros.find(id);
 	if (it == m_macros.end())
 		throw __FILE__ ": Macro does not exist";
 
-	// get replacement list
-	std::list<PreprocToken> replace = it->second;
-	// traverse replacement list for recursive substitutions
-	for (auto j = replace.begin(); j != replace.end();)
+	// outside of other macros a cached expansion is valid without checking its dependencies
+	if (it->second.expanded && m_hide_set.empty())
+	{
+		m_stats.expansion_hits++;
+		return it->second.expansion;
+	}
+
+	// expanded outside of other macros, the result is always cached
+	std::vector<PreprocToken> out;
+	std::unordered_set<std::string_view> deps;
+	expand_macro(id, &out, &deps);
+	return it->second.expansion;
+}
+
+void Preprocessor::expand_macro(std::string_view id, std::vector<PreprocToken> *out, std::unordered_set<std::string_view> *deps)
+{
+	auto depends_on_hidden = [this](std::unordered_set<std::string_view> const &ids) {
+		return std::any_of(m_hide_set.begin(), m_hide_set.end(), [&ids](std::string_view h) { return ids.count(h) != 0; });
+	};
+
+	Macro &macro = m_macros.find(id)->second;
+	// the cached expansion is valid here, unless it reaches a macro being expanded
+	if (macro.expanded && !depends_on_hidden(macro.dependencies))
+	{
+		m_stats.expansion_hits++;
+		out->insert(out->end(), macro.expansion.begin(), macro.expansion.end());
+		deps->insert(macro.dependencies.begin(), macro.dependencies.end());
+		return;
+	}
+
+	m_stats.expansions++;
+	size_t first = out->size();
+	std::unordered_set<std::string_view> own{id};
+	// the hide set of the replacement tokens: the enclosing macros and this one
+	m_hide_set.push_back(id);
+	for (auto const &pt : macro.replacement)
 	{
-		if (j->get_category() == PreprocToken::IDENTIFIER)
+		if (pt.get_category() == PreprocToken::IDENTIFIER)
 		{
-			std::string const &subid = j->get_string();
-			if (subid != id && is_defined(subid))
+			std::string_view sub = pt.get_string();
+			own.insert(sub); // defining it later would change the expansion
+			if (m_macros.count(sub) != 0 && std::find(m_hide_set.begin(), m_hide_set.end(), sub) == m_hide_set.end())
 			{
-				std::list<PreprocToken> sublist = macro_substitute(subid);
-				j = replace.erase(j);
-				replace.insert(j, sublist.begin(), sublist.end());
+				expand_macro(sub, out, &own);
+				continue;
 			}
-			else
-				++j;
 		}
-		else
-			++j;
+		out->push_back(pt);
 	}
-	return replace;
+	m_hide_set.pop_back();
+
+	// an expansion not affected by the enclosing macros is the same everywhere
+	if (!macro.expanded && !depends_on_hidden(own))
+	{
+		macro.expansion.assign(out->begin() + first, out->end());
+		macro.dependencies = own;
+		macro.expanded = true;
+		for (std::string_view dep : own)
+			m_dependents[dep].insert(id);
+	}
+	deps->insert(own.begin(), own.end());
 }
 
 bool Preprocessor::parse_unary_expression(int *result)
 {
-	if (m_current_token->get_string() == "(")
+	switch (m_current_token->get_punctuator())
+	{
+	case PreprocToken::LEFT_PAREN:
 	{
 		next_token();
 		int val;
 		parse_constant_expression(&val);
-		if (m_current_token->get_string() != ")")
+		if (m_current_token->get_punctuator() != PreprocToken::RIGHT_PAREN)
 			return false;
 		next_token();
 		*result = val;
 		return true;
 	}
-	if (m_current_token->get_string() == "+")
-	{
-		int val;
+	case PreprocToken::PLUS:
 		next_token();
-		parse_unary_expression(&val);
-		*result = val;
+		return parse_unary_expression(result);
+	case PreprocToken::MINUS:
+		next_token();
+		parse_unary_expression(result);
+		*result = -*result;
 		return true;
-	}
-	if (m_current_token->get_string() == "-")
-	{
-		int val;
+	case PreprocToken::EXCLAMATION:
 		next_token();
-		parse_unary_expression(&val);
-		*result = -val;
+		parse_unary_expression(result);
+		*result = !*result;
 		return true;
-	}
-	if (m_current_token->get_string() == "!")
-	{
-		int val;
+	case PreprocToken::TILDE:
 		next_token();
-		parse_unary_expression(&val);
-		*result = !val;
+		parse_unary_expression(result);
+		*result = ~*result;
 		return true;
+	default:
+		break;
 	}
-	if (m_current_token->get_string() == "defined")
+	if (m_current_token->get_category() == PreprocToken::IDENTIFIER && m_current_token->get_string() == "defined")
 	{
 		next_token();
 		bool is_bracket = false;
-		if (m_current_token->get_string() == "(")
+		if (m_current_token->get_punctuator() == PreprocToken::LEFT_PAREN)
 		{
 			is_bracket = true;
 			next_token();
 		}
-		std::string const &identifier = m_current_token->get_string();
+		std::string_view identifier = m_current_token->get_string();
 		*result = is_defined(identifier);
 		next_token();
 		if (is_bracket)
 		{
-			if (m_current_token->get_string() != ")")
+			if (m_current_token->get_punctuator() != PreprocToken::RIGHT_PAREN)
 				return false;
 			next_token();
 		}
@@ -674,20 +1225,20 @@ bool Preprocessor::parse_unary_expression(int *result)
 	}
 	if (m_current_token->get_category() == PreprocToken::IDENTIFIER)
 	{
-		std::string id = m_current_token->get_string();
+		std::string_view id = m_current_token->get_string();
 		if (!is_defined(id))
 			return false;
-		auto list = this->macro_substitute(id);
+		auto const &list = macro_substitute(id);
 		if (list.size() != 1)
 			return false;
-		long val = std::atol(list.begin()->get_string().c_str());
+		long val = std::atol(std::string(list.begin()->get_string()).c_str());
 		*result = val;
 		next_token();
 		return true;
 	}
 	if (m_current_token->get_category() == PreprocToken::PP_NUMBER)
 	{
-		long val = std::atol(m_current_token->get_string().c_str());
+		long val = std::atol(std::string(m_current_token->get_string()).c_str());
 		*result = val;
 		next_token();
 		return true;
@@ -695,157 +1246,65 @@ bool Preprocessor::parse_unary_expression(int *result)
 	throw __FILE__ ": Unprocessed unary expression";
 }
 
-bool Preprocessor::parse_multiplicative_expression(int *result)
-{
-	int val;
-	parse_unary_expression(&val);
-	std::string op = m_current_token->get_string();
-	while (op == "*" || op == "/" || op == "%")
-	{
-		next_token();
-		int rhs;
-		parse_unary_expression(&rhs);
-		if (op == "*")
-			val = val * rhs;
-		else if (op == "/")
-			val = val / rhs;
-		else
-			val = val % rhs;
-		op = m_current_token->get_string();
-	}
-	*result = val;
-	return true;
-}
-
-bool Preprocessor::parse_additive_expression(int *result)
-{
-	int val;
-	parse_multiplicative_expression(&val);
-	std::string op = m_current_token->get_string();
-	while (op == "+" || op == "-")
-	{
-		next_token();
-		int rhs;
-		parse_multiplicative_expression(&rhs);
-		if (op == "+")
-			val = val + rhs;
-		else
-			val = val - rhs;
-		op = m_current_token->get_string();
-	}
-	*result = val;
-	return true;
-}
-
-bool Preprocessor::parse_shift_expression(int *result)
-{
-	int val;
-	parse_additive_expression(&val);
-	std::string op = m_current_token->get_string();
-	while (op == "<<" || op == ">>")
-	{
-		next_token();
-		int rhs;
-		parse_additive_expression(&rhs);
-		if (op == "<<")
-			val = val << rhs;
-		else
-			val = val >> rhs;
-		op = m_current_token->get_string();
-	}
-	*result = val;
-	return true;
-}
-
-bool Preprocessor::parse_relational_expression(int *result)
+std::array<Preprocessor::BinaryOperator, PreprocToken::N_PUNCTUATORS> Preprocessor::make_operator_table()
 {
-	int val;
-	parse_shift_expression(&val);
-	std::string op = m_current_token->get_string();
-	while (op == "<" || op == ">" || op == "<=" || op == ">=")
-	{
-		next_token();
-		int rhs;
-		parse_shift_expression(&rhs);
-		if (op == "<")
-			val = val < rhs;
-		else if (op == ">")
-			val = val > rhs;
-		else if (op == "<=")
-			val = val <= rhs;
-		else
-			val = val >= rhs;
-		op = m_current_token->get_string();
-	}
-	*result = val;
-	return true;
+	std::array<BinaryOperator, PreprocToken::N_PUNCTUATORS> table{};
+	table[PreprocToken::ASTERISK] = {10, [](int a, int b) { return a * b; }};
+	table[PreprocToken::SLASH] = {10, [](int a, int b) { return a / b; }};
+	table[PreprocToken::PERCENT] = {10, [](int a, int b) { return a % b; }};
+	table[PreprocToken::PLUS] = {9, [](int a, int b) { return a + b; }};
+	table[PreprocToken::MINUS] = {9, [](int a, int b) { return a - b; }};
+	table[PreprocToken::LEFT_SHIFT] = {8, [](int a, int b) { return a << b; }};
+	table[PreprocToken::RIGHT_SHIFT] = {8, [](int a, int b) { return a >> b; }};
+	table[PreprocToken::LESS] = {7, [](int a, int b) { return int(a < b); }};
+	table[PreprocToken::GREATER] = {7, [](int a, int b) { return int(a > b); }};
+	table[PreprocToken::LESS_EQUAL] = {7, [](int a, int b) { return int(a <= b); }};
+	table[PreprocToken::GREATER_EQUAL] = {7, [](int a, int b) { return int(a >= b); }};
+	table[PreprocToken::EQUAL] = {6, [](int a, int b) { return int(a == b); }};
+	table[PreprocToken::NOT_EQUAL] = {6, [](int a, int b) { return int(a != b); }};
+	table[PreprocToken::AMPERSAND] = {5, [](int a, int b) { return a & b; }};
+	table[PreprocToken::CARET] = {4, [](int a, int b) { return a ^ b; }};
+	table[PreprocToken::BAR] = {3, [](int a, int b) { return a | b; }};
+	table[PreprocToken::LOGICAL_AND] = {2, [](int a, int b) { return int(a && b); }};
+	table[PreprocToken::LOGICAL_OR] = {1, [](int a, int b) { return int(a || b); }};
+	return table;
 }
 
-bool Preprocessor::parse_equality_expression(int *result)
+bool Preprocessor::parse_binary_expression(int *result, int min_precedence)
 {
 	int val;
-	parse_relational_expression(&val);
-	std::string op = m_current_token->get_string();
-	while (op == "==" || op == "!=")
+	parse_unary_expression(&val);
+	while (true)
 	{
+		BinaryOperator const &op = m_binary_operators[m_current_token->get_punctuator()];
+		if (op.precedence == 0 || op.precedence < min_precedence)
+			break;
 		next_token();
+		// all binary operators are left associative, the right operand binds stronger
 		int rhs;
-		parse_relational_expression(&rhs);
-		if (op == "==")
-			val = val == rhs;
-		else
-			val = val != rhs;
-		op = m_current_token->get_string();
+		parse_binary_expression(&rhs, op.precedence + 1);
+		val = op.apply(val, rhs);
 	}
 	*result = val;
 	return true;
 }
 
-bool Preprocessor::parse_and_expression(int *result)
-{
-	return parse_xpr(result, &Preprocessor::parse_equality_expression, "&",
-					 [](int a, int b) { return a & b; });
-}
-
-bool Preprocessor::parse_exclusive_or_expression(int *result)
-{
-	return parse_xpr(result, &Preprocessor::parse_and_expression, "^",
-					 [](int a, int b) { return a ^ b; });
-}
-
-bool Preprocessor::parse_inclusive_or_expression(int *result)
-{
-	return parse_xpr(result, &Preprocessor::parse_exclusive_or_expression, "|",
-					 [](int a, int b) { return a | b; });
-}
-
-bool Preprocessor::parse_logical_and_expression(int *result)
-{
-	return parse_xpr(result, &Preprocessor::parse_inclusive_or_expression, "&&",
-					 [](int a, int b) { return a && b; });
-}
-
-bool Preprocessor::parse_logical_or_expression(int *result)
-{
-	return parse_xpr(result, &Preprocessor::parse_logical_and_expression, "||",
-					 [](int a, int b) { return a || b; });
-}
-
 bool Preprocessor::parse_conditional_expression(int *result)
 {
 	int cond;
-	parse_logical_or_expression(&cond);
-	if (m_current_token->get_string() == "?")
+	parse_binary_expression(&cond, 1);
+	if (m_current_token->get_punctuator() == PreprocToken::QUESTION)
 	{
 		next_token();
 		int tr, fls;
 		parse_constant_expression(&tr);
-		if (m_current_token->get_string() != ":")
+		if (m_current_token->get_punctuator() != PreprocToken::COLON)
 			return false;
 		next_token();
-		parse_constant_expression(&fls);
+		parse_conditional_expression(&fls);
 		*result = cond ? tr : fls;
 	}
-	*result = cond;
+	else
+		*result = cond;
 	return true;
 }
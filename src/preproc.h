@@ -11,34 +11,143 @@
 #ifndef PREPROC_H_INCLUDED
 #define PREPROC_H_INCLUDED
 
+#include "char_scan.h"
+#include "file_buffer.h"
 #include "preproc_token.h"
 
+#include <array>
 #include <cstring>
 #include <fstream>
 #include <list>
-#include <map>
 #include <streambuf>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 /** @brief declaration of the preprocessor class
  * 
- * @details the preprocessor preprocesses a source file and writes
- * the result into a destination file
+ * @details the preprocessor preprocesses a source file and collects
+ * the resulting pp-tokens that are handed over to the lexer
 */
 class Preprocessor
 {
 public:
 	/**
-	 * @brief Preprocesses the C file fname. The preprocessed file is written into prepname.
+	 * @brief Preprocesses the C file fname. The result is stored as a list of pp-tokens.
 	 * 
 	 * @param fname name of the source file
-	 * @param prepname name of the result file
 	 */
-	void process(char const *fname, char const *prepname);
+	void process(char const *fname);
+
+	/**
+	 * @brief Only follow the directives of the source files, text lines are neither read nor output
+	 * 
+	 * @details this is enough to find the dependencies of a source file
+	 */
+	void set_scan_only(bool scan_only) { m_scan_only = scan_only; }
+
+	/**
+	 * @brief Return the preprocessed pp-tokens
+	 * 
+	 * @details white space sequences and new lines are kept,
+	 * each token knows its position in its source file
+	 */
+	std::vector<PreprocToken> const &get_token_list() const { return m_output; }
+
+	/**
+	 * @brief Write the preprocessed text into an output stream
+	 * 
+	 * @param os the output stream
+	 */
+	void print_text(std::ostream &os) const;
+
+	/**
+	 * @brief Write the counters of the source file cache into an output stream
+	 * 
+	 * @param os the output stream
+	 */
+	void print_statistics(std::ostream &os) const;
+
+	/**
+	 * @brief Write a make rule listing the source files opened during preprocessing
+	 * 
+	 * @param os the output stream
+	 * @param target the target of the rule
+	 */
+	void print_dependencies(std::ostream &os, std::string const &target) const;
+
+	/**
+	 * @brief Add a directory to the include search path
+	 * 
+	 * @details #include "name" is searched in the directory of the including file first,
+	 * then both forms are searched in the -I directories, the system directories,
+	 * and finally in the current working directory
+	 * 
+	 * @param dir the directory
+	 * @param system the directory is searched after all non-system directories
+	 */
+	void add_include_path(std::string const &dir, bool system);
 
 private:
+	/** @brief a source file, cached for the whole compilation */
+	struct SourceFile
+	{
+		/** @brief the pp-tokens of a logical line and the offset of the following line */
+		struct Line
+		{
+			std::vector<PreprocToken> tokens;
+			size_t next;
+		};
+
+		std::string dir;							///< the directory of the file, quoted includes are searched here first
+		FileBuffer buffer;							///< the contents of the file, owned for the whole compilation
+		std::string_view text;						///< contents of the file without line splices, null terminated
+		std::vector<size_t> line_starts;			///< offsets in text where the physical lines start
+		std::unordered_map<size_t, Line> lines;	///< the lines tokenized so far, indexed by their offset
+		size_t size = 0;							///< size of the file in bytes
+		bool analyzed = false;						///< the file has been checked for include guards
+		std::string guard;							///< the include guard macro, empty if there is none
+		bool once = false;							///< the file contains #pragma once
+		bool included = false;						///< the file has already been included
+	};
+
+	/** @brief a file being preprocessed and the offset of its next line */
+	struct Source
+	{
+		SourceFile *file;
+		size_t pos;
+	};
+
+	/** @brief an object-like macro and its cached expansion */
+	struct Macro
+	{
+		std::vector<PreprocToken> replacement;		///< the replacement list as defined
+		std::vector<PreprocToken> expansion;		///< the fully expanded replacement list, valid if expanded is set
+		std::unordered_set<std::string_view> dependencies;	///< the identifiers the expansion depends on
+		bool expanded = false;						///< the expansion is cached
+	};
+
+	/** @brief counters of the source file and macro caches */
+	struct Statistics
+	{
+		size_t includes = 0;		///< number of processed #include directives
+		size_t files_read = 0;		///< number of files read and tokenized
+		size_t files_mapped = 0;	///< number of files mapped into memory instead of read
+		size_t cache_hits = 0;		///< number of files taken from the cache
+		size_t skipped = 0;			///< number of includes skipped due to guards or #pragma once
+		size_t bytes_skipped = 0;	///< total size of the skipped files
+		size_t lines_tokenized = 0;	///< number of tokenized lines
+		size_t group_bytes = 0;		///< total size of the skipped conditional groups
+		size_t expansions = 0;		///< number of macro expansions computed
+		size_t expansion_hits = 0;	///< number of macro expansions taken from the cache
+		size_t lookups = 0;			///< number of include file lookups
+		size_t lookup_hits = 0;		///< number of include file lookups answered by the cache
+		size_t probes = 0;			///< number of file system queries of include file candidates
+	};
+
 	/** @brief determines if a character is a white space (excluding new lines) */
-	static bool is_white_space(char c);
+	static bool is_white_space(char c) { return CharScan::is_blank(c); }
 
 	/** @brief parses white space sequences into a token */
 	static char const *lex_white_space_sequence(char const *s, PreprocToken *pt);
@@ -53,10 +162,10 @@ private:
 	static char const *lex_q_header_name(char const *s, PreprocToken *pt);
 
 	/** @brief determines if character is a first identifier char or not */
-	static bool is_identifier_nondigit(char c) { return isalpha(c) || c == '_'; }
+	static bool is_identifier_nondigit(char c) { return CharScan::is_identifier_nondigit(c); }
 
 	/** @brief determines if character is an identifier char or not */
-	static bool is_identifier(char c) { return isalnum(c) || c == '_'; }
+	static bool is_identifier(char c) { return CharScan::is_identifier(c); }
 
 	/** @brief parses identifiers into a token */
 	static char const *lex_identifier(char const *str, PreprocToken *pt);
@@ -85,13 +194,68 @@ private:
 	/** @brief parses a punctuator into a token */
 	static char const *lex_punctuator(char const *str, PreprocToken *pt);
 
-	/** @brief transform a string into a list of tokens */
-	std::list<PreprocToken> tokenize(char const *fname);
+	/** @brief parses a comment or a punctuator starting with / into a token */
+	static char const *lex_slash(char const *str, PreprocToken *pt);
+
+	/** @brief parses a preprocessor number or a punctuator starting with . into a token */
+	static char const *lex_dot(char const *str, PreprocToken *pt);
+
+	/** @brief signature of the lexer functions */
+	using lexer_fptr = char const *(*)(char const *, PreprocToken *);
+
+	/** @brief build the table of lexer functions indexed by the first character of the token */
+	static std::array<lexer_fptr, 256> make_lexer_table();
+
+	/** @brief determines if the tokens lexed so far end in an #include directive */
+	static bool is_include_directive(std::vector<PreprocToken> const &line);
+
+	/** @brief transform the logical line of a file starting at pos into tokens, return the offset of the next line */
+	static size_t tokenize(SourceFile const &file, size_t pos, std::vector<PreprocToken> *line);
+
+	/** @brief return a source file from the cache, read it if needed */
+	SourceFile &load_file(std::string const &fname);
+
+	/**
+	 * @brief find the file of an include directive
+	 * 
+	 * @param header the header name as written, including the quotes or angle brackets
+	 * @param dir the directory of the including file
+	 * @return the path of the file, empty if the file cannot be found
+	 */
+	std::string const &find_include(std::string const &header, std::string const &dir);
+
+	/** @brief determines if a file exists, the result is cached */
+	bool file_exists(std::string const &path);
+
+	/**
+	 * @brief find the end of a logical line without tokenizing it
+	 * 
+	 * @param text the text of a source file
+	 * @param pos the offset of the line
+	 * @param blank if not nullptr, set to false if the line contains anything but white spaces and comments
+	 * @return the offset of the following line
+	 */
+	static size_t end_of_line(std::string_view text, size_t pos, bool *blank);
+
+	/** @brief find the next line starting with #, the lines before are only scanned for comments */
+	static size_t find_directive(std::string_view text, size_t pos, bool *blank);
+
+	/** @brief read the directive name and the identifier following it from a line starting with # */
+	static std::string read_directive(std::string_view text, size_t pos, std::string *arg);
+
+	/** @brief determines if a file consists of a single #ifndef guarded group or contains #pragma once */
+	static void detect_include_guard(SourceFile *file);
+
+	/** @brief make the next line of the current source file the current token list */
+	void read_line();
+
+	/** @brief determines if including the file again has no effect */
+	bool is_skippable(SourceFile &file) const;
 
 	/** @brief the entry point of parsing */
 	bool parse_preprocessing_file()
 	{
-		while (m_current_token != m_end)
+		while (m_current_token != m_pp_token_list.end())
 			if (!parse_group_part())
 				return false;
 		return true;
@@ -109,6 +273,12 @@ private:
 	/** @brief parse an if-group nonterminal */
 	bool parse_if_group(int *cond);
 
+	/** @brief parse the group parts following an if, elif or else line */
+	bool parse_group();
+
+	/** @brief skip an inactive group, only directive lines are tokenized */
+	bool skip_group();
+
 	/** @brief parse a control-line nonterminal */
 	bool is_elif_group() const;
 
@@ -150,92 +320,86 @@ private:
 		return parse_conditional_expression(result);
 	}
 
-	bool is_defined(std::string const &identifier) const
+	bool is_defined(std::string_view identifier) const
 	{
 		return m_macros.find(identifier) != m_macros.end();
 	}
 
-	using parsing_function = bool (Preprocessor::*)(int *);
-
-	template <class Op>
-	bool parse_xpr(int *result, parsing_function parse, std::string const &str, Op op)
-	{
-		int val;
-		(this->*parse)(&val);
-		while (m_current_token->get_string() == str)
-		{
-			next_token();
-			int rhs;
-			(this->*parse)(&rhs);
-			val = op(val, rhs);
-		}
-		*result = val;
-		return true;
-	}
-
 	bool parse_unary_expression(int *result);
 
-	bool parse_multiplicative_expression(int *result);
-
-	bool parse_additive_expression(int *result);
-
-	bool parse_shift_expression(int *result);
-
-	bool parse_relational_expression(int *result);
-
-	bool parse_equality_expression(int *result);
-
-	bool parse_and_expression(int *result);
-
-	bool parse_exclusive_or_expression(int *result);
-
-	bool parse_inclusive_or_expression(int *result);
+	/** @brief a binary operator of #if expressions */
+	struct BinaryOperator
+	{
+		int precedence;				///< the binding strength, 0 if the punctuator is not a binary operator
+		int (*apply)(int, int);		///< the evaluation of the operator
+	};
 
-	bool parse_logical_and_expression(int *result);
+	/** @brief build the table of binary operators indexed by the punctuator code */
+	static std::array<BinaryOperator, PreprocToken::N_PUNCTUATORS> make_operator_table();
 
-	bool parse_logical_or_expression(int *result);
+	/** @brief parse binary operators binding at least as strong as min_precedence by precedence climbing */
+	bool parse_binary_expression(int *result, int min_precedence);
 
 	bool parse_conditional_expression(int *result);
 
 	void next_token(bool skip_spaces = true)
 	{
-		m_current_token++;
+		if (m_current_token->get_category() == PreprocToken::NEW_LINE)
+			read_line();
+		else
+			m_current_token++;
 		if (skip_spaces)
 			skip_white_spaces();
 	}
 
 	void skip_white_spaces()
 	{
-		while (m_current_token->is_white_space())
+		while (m_current_token != m_pp_token_list.end() && m_current_token->is_white_space())
 			next_token();
 	}
 
-	void add_macro(std::string const &identifier)
-	{
-		m_macros[identifier] = std::list<PreprocToken>();
-	}
+	/** @brief define a macro, or redefine it with a new replacement list */
+	void add_macro(std::string_view id, std::vector<PreprocToken> replacement);
 
-	void remove_macro(std::string const &identifier)
-	{
-		auto it = m_macros.find(identifier);
-		if (it != m_macros.end())
-			m_macros.erase(it);
-	}
+	void remove_macro(std::string_view id);
 
-	void add_macro_replacement(std::string const &identifier, PreprocToken const &tok)
-	{
-		m_macros[identifier].push_back(tok);
-	}
+	/** @brief drop the cached expansions depending on an identifier that is being (un)defined */
+	void invalidate_expansions(std::string_view id);
 
-	/** @brief substitute a macro and return a list of preproc tokents */
-	std::list<PreprocToken> macro_substitute(std::string const &id) const;
+	/** @brief substitute a macro and return its fully expanded replacement list */
+	std::vector<PreprocToken> const &macro_substitute(std::string_view id);
+
+	/**
+	 * @brief append the expansion of a macro to a token list
+	 * 
+	 * @param id the macro to expand
+	 * @param out the expanded tokens are appended to this list
+	 * @param deps the identifiers looked up during the expansion are added to this set
+	 */
+	void expand_macro(std::string_view id, std::vector<PreprocToken> *out, std::unordered_set<std::string_view> *deps);
 
 private:
-	std::list<PreprocToken> m_pp_token_list;
-	std::list<PreprocToken>::iterator m_current_token, m_end;
-	std::map<std::string, std::list<PreprocToken>> m_macros;
+	/** @brief the lexer function of each leading character, nullptr if no pp-token starts with it */
+	static std::array<lexer_fptr, 256> const m_lexers;
+	/** @brief the binary operators of #if expressions */
+	static std::array<BinaryOperator, PreprocToken::N_PUNCTUATORS> const m_binary_operators;
+
+	std::list<PreprocToken> m_pp_token_list;	// the current line
+	std::list<PreprocToken>::iterator m_current_token;
+	std::vector<Source> m_sources;	// the stack of included files
+	std::unordered_map<std::string_view, Macro> m_macros;	// the names refer into the source file buffers
+	std::unordered_map<std::string_view, std::unordered_set<std::string_view>> m_dependents;	// the macros whose cached expansion depends on an identifier
+	std::vector<std::string_view> m_hide_set;	// the macros being expanded, they are not expanded again
+	std::vector<PreprocToken> m_output;
+	std::unordered_map<std::string, SourceFile> m_files;
+	std::vector<std::string> m_dependencies;	// the names of the opened files in order of their first inclusion
+	std::vector<std::string> m_include_paths;	// the -I directories
+	std::vector<std::string> m_system_paths;	// the -isystem directories
+	std::unordered_map<std::string, std::string> m_include_cache;	// (directory, header name) to path, empty if not found
+	std::unordered_map<std::string, bool> m_file_exists;			// the candidate paths already probed
+	Statistics m_stats;
 	bool m_write;
-	std::ofstream m_ofs;
+	bool m_scan_only = false;
 };
 
 #endif
@@ -1,7 +1,9 @@
 #ifndef PREPROC_TOKEN_H_INCLUDED
 #define PREPROC_TOKEN_H_INCLUDED
 
-#include <string>
+#include "coordinate.h"
+
+#include <string_view>
 
 /** @brief class representing a preprocessor token */
 class PreprocToken
@@ -21,6 +23,61 @@ public:
 		WHITE_SPACE_SEQUENCE	/// any sequence of ' ', '\t'
 	};
 
+	/** @brief the code of a punctuator, assigned when the token is lexed */
+	enum Punctuator
+	{
+		NOT_PUNCTUATOR,	///< the token is not a punctuator
+		ELLIPSIS,		///< ...
+		RIGHT_ASSIGN,	///< >>=
+		LEFT_ASSIGN,	///< <<=
+		XOR_ASSIGN,		///< ^=
+		OR_ASSIGN,		///< |=
+		AND_ASSIGN,		///< &=
+		ADD_ASSIGN,		///< +=
+		SUB_ASSIGN,		///< -=
+		MUL_ASSIGN,		///< *=
+		DIV_ASSIGN,		///< /=
+		MOD_ASSIGN,		///< %=
+		LOGICAL_OR,		///< ||
+		LOGICAL_AND,	///< &&
+		EQUAL,			///< ==
+		NOT_EQUAL,		///< !=
+		LEFT_SHIFT,		///< <<
+		RIGHT_SHIFT,	///< >>
+		LESS_EQUAL,		///< <=
+		GREATER_EQUAL,	///< >=
+		INCREMENT,		///< ++
+		DECREMENT,		///< --
+		ARROW,			///< ->
+		SEMICOLON,		///< ;
+		LEFT_PAREN,		///< (
+		RIGHT_PAREN,	///< )
+		LEFT_BRACE,		///< {
+		RIGHT_BRACE,	///< }
+		PLUS,			///< +
+		MINUS,			///< -
+		ASTERISK,		///< *
+		ASSIGN,			///< =
+		PERCENT,		///< %
+		SLASH,			///< /
+		LESS,			///< <
+		GREATER,		///< >
+		AMPERSAND,		///< &
+		BAR,			///< |
+		CARET,			///< ^
+		TILDE,			///< ~
+		COMMA,			///< ,
+		LEFT_BRACKET,	///< [
+		RIGHT_BRACKET,	///< ]
+		DOT,			///< .
+		QUESTION,		///< ?
+		COLON,			///< :
+		EXCLAMATION,	///< !
+		HASH_HASH,		///< ##
+		HASH,			///< #
+		N_PUNCTUATORS	///< the number of punctuator codes
+	};
+
 	/** @brief Set the category member */
 	void set_category(Category const &cat) { m_cat = cat; }
 
@@ -28,17 +85,31 @@ public:
 	Category const &get_category() const { return m_cat; }
 
 	/** @brief Set the string member */
-	void set_string(std::string const &str) { m_str = str; }
+	void set_string(std::string_view str) { m_str = str; }
 
 	/** @brief Get the string member */
-	std::string const &get_string() const { return m_str; }
+	std::string_view get_string() const { return m_str; }
+
+	/** @brief Set the position of the token in its source file */
+	void set_coordinate(Coordinate const &coord) { m_coord = coord; }
+
+	/** @brief Get the position of the token in its source file */
+	Coordinate const &get_coordinate() const { return m_coord; }
+
+	/** @brief Set the punctuator code */
+	void set_punctuator(Punctuator punct) { m_punct = punct; }
+
+	/** @brief Get the punctuator code, NOT_PUNCTUATOR for other categories */
+	Punctuator get_punctuator() const { return m_punct; }
 
 	/** @brief indicate if the token is white space or not */
 	bool is_white_space() const { return get_category() == WHITE_SPACE_SEQUENCE; }
 
 private:
 	Category m_cat;
-	std::string m_str;
+	std::string_view m_str;	///< refers into the source file buffers or to a string literal
+	Punctuator m_punct = NOT_PUNCTUATOR;
+	Coordinate m_coord;	///< physical line and column, line splices included
 };
 
 #endif
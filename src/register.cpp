@@ -2,11 +2,16 @@
 
 std::string Register::str() const
 {
-	struct
+	return std::string("%") + name();
+}
+
+char const *Register::name(Id id, size_t size)
+{
+	static struct
 	{
 		Id id;
 		char const *strs[4];
-	} data[] = {
+	} const data[] = {
 		{Id::AX, {"al", "ax", "eax", "rax"}},
 		{Id::BX, {"bl", "bx", "ebx", "rbx"}},
 		{Id::CX, {"cl", "cx", "ecx", "rcx"}},
@@ -41,14 +46,14 @@ std::string Register::str() const
 		{Id::XMM15, {NULL, NULL, "xmm15", "xmm15"}}};
 
 	// determine the size's logarithm
-	size_t cntr = 0, size = m_size;
+	size_t cntr = 0;
 	while (size != 1)
 	{
 		size >>= 1;
 		cntr++;
 	}
 	for (int i = 0; i < sizeof data / sizeof data[0]; ++i)
-		if (data[i].id == m_id)
-			return std::string("%") + data[i].strs[cntr];
+		if (data[i].id == id)
+			return data[i].strs[cntr];
 	throw __FILE__ "Invalid register id";
 }
@@ -100,6 +100,12 @@ public:
 	/** \brief return a textual identifier of the register */
 	std::string str() const;
 
+	/** \brief return the name of the register without the '%' prefix */
+	char const *name() const { return name(m_id, m_size); }
+
+	/** \brief return the name of a register of the given size without the '%' prefix */
+	static char const *name(Id id, size_t size);
+
 	/** \brief return the stored number's size in bítes */
 	size_t get_size() const { return m_size; };
 
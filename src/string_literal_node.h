@@ -1,10 +1,9 @@
 #ifndef STRING_LITERAL_NODE_H_INCLUDED
 #define STRING_LITERAL_NODE_H_INCLUDED
 
+#include "symbol.h"
 #include "xpr_node.h"
 
-#include <string>
-
 class StringLiteralNode : public XprNode
 {
 public:
@@ -14,7 +13,7 @@ public:
 		set_xpr_type(Type::char_type().pointer_to());
 	}
 
-	StringLiteralNode(std::string const &str)
+	StringLiteralNode(Symbol str)
 		: XprNode(XprNode::Id::STRING_LITERAL)
 		, m_string(str)
 	{
@@ -28,15 +27,15 @@ public:
 
 	virtual XprNode *clone() override
 	{
-		return new StringLiteralNode(*this);
+		return create<StringLiteralNode>(*this);
 	}
 
-	void set_string(std::string const str) { m_string = str; }
+	void set_string(Symbol str) { m_string = str; }
 
-	std::string const &get_string() const { return m_string; }
+	Symbol get_string() const { return m_string; }
 
 private:
-	std::string m_string;
+	Symbol m_string;
 };
 
 #endif
@@ -0,0 +1,22 @@
+#include "symbol.h"
+
+std::deque<std::string> Symbol::m_pool(1); // the empty string
+std::unordered_map<std::string_view, unsigned> Symbol::m_index_map;
+
+unsigned Symbol::intern(std::string_view str)
+{
+	if (str.empty())
+		return 0;
+	auto it = m_index_map.find(str);
+	if (it != m_index_map.end())
+		return it->second;
+	unsigned index = m_pool.size();
+	m_pool.emplace_back(str);
+	m_index_map.emplace(m_pool.back(), index);
+	return index;
+}
+
+std::ostream &operator<<(std::ostream &os, Symbol sym)
+{
+	return os << sym.str();
+}
@@ -0,0 +1,91 @@
+/**
+ * @file symbol.h
+ * @author Peter Fiala (fiala@hit.bme.hu)
+ * @brief declaration of class ::Symbol
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef SYMBOL_H_INCLUDED
+#define SYMBOL_H_INCLUDED
+
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief Representation of interned strings (identifiers and string literals)
+ *
+ * @details Each distinct spelling is stored only once in a static pool
+ * and a Symbol is the index of its spelling in the pool. Copying symbols and
+ * comparing them for equality are thus integer operations.
+ * The empty string is the symbol with index 0.
+ */
+class Symbol
+{
+public:
+	/** @brief Construct the empty symbol */
+	Symbol() : m_index(0) { }
+
+	/** @brief Construct the symbol of a spelling, the spelling is installed in the pool if needed */
+	Symbol(std::string_view str) : m_index(intern(str)) { }
+
+	/** @brief Construct the symbol of a spelling, the spelling is installed in the pool if needed */
+	Symbol(std::string const &str) : Symbol(std::string_view(str)) { }
+
+	/** @brief Construct the symbol of a spelling, the spelling is installed in the pool if needed */
+	Symbol(char const *str) : Symbol(std::string_view(str)) { }
+
+	/** @brief Return the spelling of the symbol */
+	std::string const &str() const { return m_pool[m_index]; }
+
+	/** @brief Return the index of the symbol in the pool */
+	unsigned get_index() const { return m_index; }
+
+	/** @brief Indicate if the symbol is the empty string */
+	bool empty() const { return m_index == 0; }
+
+	bool operator==(Symbol other) const { return m_index == other.m_index; }
+
+	bool operator!=(Symbol other) const { return m_index != other.m_index; }
+
+	/** @brief Return the number of distinct spellings in the pool */
+	static size_t pool_size() { return m_pool.size(); }
+
+	/** @brief Delete the pool of spellings */
+	static void free_pool()
+	{
+		m_index_map.clear();
+		m_pool.resize(1);
+	}
+
+private:
+	/** @brief Return the index of a spelling, install the spelling if it is not in the pool yet */
+	static unsigned intern(std::string_view str);
+
+	unsigned m_index;
+
+	/** @brief the spellings, a deque does not move its elements when growing */
+	static std::deque<std::string> m_pool;
+	/** @brief index of the spellings, the keys refer to the strings of the pool */
+	static std::unordered_map<std::string_view, unsigned> m_index_map;
+};
+
+std::ostream &operator<<(std::ostream &os, Symbol sym);
+
+namespace std
+{
+	/** @brief Symbols are hashed by their index */
+	template <>
+	struct hash<Symbol>
+	{
+		size_t operator()(Symbol sym) const { return hash<unsigned>()(sym.get_index()); }
+	};
+}
+
+#endif
@@ -13,11 +13,13 @@
 
 #include "serializable.h"
 #include "storage.h"
+#include "symbol.h"
 #include "type.h"
 
 #include <iomanip>
 #include <list>
 #include <string>
+#include <unordered_map>
 
 /** @brief one entry of the symbol table */
 class SymbolTableEntry
@@ -41,7 +43,7 @@ public:
 	 * @param storage the entry's storage
 	 * @param linkage the entry's linkage
 	 */
-	SymbolTableEntry(Category cat, std::string const &id, Type const &type, Storage storage, Linkage linkage = Linkage::NO_LINKAGE)
+	SymbolTableEntry(Category cat, Symbol id, Type const &type, Storage storage, Linkage linkage = Linkage::NO_LINKAGE)
 		: m_category(cat)
 		, m_identifier(id)
 		, m_type(type)
@@ -54,7 +56,7 @@ public:
 	Category get_category() const { return m_category; }
 
 	/** @brief return the identifier of a symbol table entry */
-	std::string const &get_id() const { return m_identifier; }
+	Symbol get_id() const { return m_identifier; }
 
 	/** @brief return the type of a symbol table entry */
 	Type const &get_type() const { return m_type; }
@@ -90,13 +92,17 @@ public:
 
 private:
 	Category m_category;
-	std::string m_identifier;
+	Symbol m_identifier;
 	Type m_type;
 	Storage m_storage;
 	Linkage m_linkage;
 };
 
-/** @brief Class representing a Symbol table and its operations */
+/** @brief Class representing a Symbol table and its operations
+ *
+ * @details The entries are stored in a list in reverse order of installation,
+ * and are indexed by a hash table for constant time lookup.
+ */
 class SymbolTable
 	: std::list<SymbolTableEntry>,
 	  public Serializable
@@ -112,33 +118,40 @@ public:
 	using std::list<SymbolTableEntry>::crbegin;
 	using std::list<SymbolTableEntry>::crend;
 
+	SymbolTable() = default;
+
+	/** @brief the index refers into the list, so tables are not copied */
+	SymbolTable(SymbolTable const &other) = delete;
+
+	SymbolTable const &operator=(SymbolTable const &other) = delete;
+
 	/** @brief lookup a symbol in the table and return a pointer to its entry
 	 *  @return pointer to the table entry of nullptr
 	 */
-	SymbolTableEntry *lookup(std::string const &id)
+	SymbolTableEntry *lookup(Symbol id)
 	{
-		for (auto &entry : *this)
-			if (entry.get_id() == id)
-				return &entry;
-		return nullptr;
+		auto it = m_index.find(id);
+		return it == m_index.end() ? nullptr : it->second;
 	}
 
 	/**
 	 *  @brief install a new entry into the table
 	 *  @return true if a new entry needed to be allocated. False if the entry was already contained.
 	 */
-	bool install(SymbolTableEntry::Category cat, std::string const &id, Type const &type, Storage storage)
+	bool install(SymbolTableEntry::Category cat, Symbol id, Type const &type, Storage storage)
 	{
-		if (lookup(id) != nullptr)
+		auto inserted = m_index.emplace(id, nullptr);
+		if (!inserted.second)
 			return false;
 		this->push_front(SymbolTableEntry(cat, id, type, storage));
+		inserted.first->second = &this->front();
 		return true;
 	}
 
 	/** @brief lookup a symbol's type
 	 * @return pointer to the type
 	 */
-	Type *lookup_type(std::string const &id)
+	Type *lookup_type(Symbol id)
 	{
 		SymbolTableEntry *pe = lookup(id);
 		if (pe == nullptr)
@@ -146,20 +159,19 @@ public:
 		return &(pe->get_type());
 	}
 
+	/** @brief install an enumeration constant declared in the scope of the table
+	 * @return true if the constant could be installed, false if it has already been installed
+	 */
+	bool install_constant(Symbol id, int value)
+	{
+		return m_constants.emplace(id, value).second;
+	}
+
 	/** @brief lookup an enumeration constant */
-	int const *lookup_constant(std::string const &id) const
+	int const *lookup_constant(Symbol id) const
 	{
-		for (auto const &se : *this)
-		{
-			Type const &t = se.get_type();
-			if (t.is_enumerated())
-			{
-				int const *p = t.lookup_enum_constant(id);
-				if (p != nullptr)
-					return p;
-			}
-		}
-		return nullptr;
+		auto it = m_constants.find(id);
+		return it == m_constants.end() ? nullptr : &it->second;
 	}
 
 	void print(std::ostream &os, size_t level = 0) const override
@@ -170,6 +182,11 @@ public:
 
 	/** @brief indicates if the table is empty */
 	bool empty() const { return Container::empty(); }
+
+private:
+	std::unordered_map<Symbol, SymbolTableEntry *> m_index;
+	/** @brief enumeration constants of the scope and their values */
+	std::unordered_map<Symbol, int> m_constants;
 };
 
 #endif // SYMBOL_TABLE_H_INCLUDED
@@ -1,11 +1,11 @@
 #include "symbol_tree.h"
 
-SymbolTableEntry *SymbolNode::lookup_local(std::string const &id)
+SymbolTableEntry *SymbolNode::lookup_local(Symbol id)
 {
 	return m_symbol_table.lookup(id);
 }
 
-SymbolTableEntry *SymbolNode::lookup_global(std::string const &id)
+SymbolTableEntry *SymbolNode::lookup_global(Symbol id)
 {
 	SymbolNode *p = this;
 	while (p != nullptr)
@@ -18,7 +18,7 @@ SymbolTableEntry *SymbolNode::lookup_global(std::string const &id)
 	return nullptr;
 }
 
-int const *SymbolNode::lookup_constant_global(std::string const &id) const
+int const *SymbolNode::lookup_constant_global(Symbol id) const
 {
 	SymbolNode const *p = this;
 	while (p != nullptr)
@@ -36,18 +36,18 @@ public:
 	void set_parent(SymbolNode *p) { m_parent = p; }
 
 	/** @brief local lookup of an identifier */
-	SymbolTableEntry *lookup_local(std::string const &id);
+	SymbolTableEntry *lookup_local(Symbol id);
 
 	/** @brief global lookup of an identifier */
-	SymbolTableEntry *lookup_global(std::string const &id);
+	SymbolTableEntry *lookup_global(Symbol id);
 
 	/** @brief global lookup of a constant */
-	int const *lookup_constant_global(std::string const &id) const;
+	int const *lookup_constant_global(Symbol id) const;
 
 	/** @brief install a new typedef into the symbol tree
 	 * @return true if the type could be installed or has already been there, false if the typedef name is reserved for an other type
 	*/
-	bool install_type(std::string const &id, Type const &type)
+	bool install_type(Symbol id, Type const &type)
 	{
 		if (!m_symbol_table.install(SymbolTableEntry::TYPE, id, type, Storage::NO_STORAGE))
 			return *m_symbol_table.lookup_type(id) == type;
@@ -57,13 +57,21 @@ public:
 	/** @brief install a new object into the symbol tree
 	 * @return true if the object could be installed, false if it has already been installed
 	*/
-	bool install_object(std::string const &id, Type const &type, Storage storage)
+	bool install_object(Symbol id, Type const &type, Storage storage)
 	{
 		return m_symbol_table.install(SymbolTableEntry::OBJECT, id, type, storage);
 	}
 
+	/** @brief install a new enumeration constant into the symbol tree
+	 * @return true if the constant could be installed, false if it has already been installed
+	*/
+	bool install_constant(Symbol id, int value)
+	{
+		return m_symbol_table.install_constant(id, value);
+	}
+
 	/** @brief install a new function into the symbol tree */
-	bool install_function(std::string const &id, Type const &type, Storage storage = Storage::EXTERN)
+	bool install_function(Symbol id, Type const &type, Storage storage = Storage::EXTERN)
 	{
 		if (!m_symbol_table.install(SymbolTableEntry::FUNCTION, id, type, storage))
 			return *m_symbol_table.lookup_type(id) == type;
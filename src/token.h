@@ -12,12 +12,16 @@
 #define TOKEN_H_INCLUDED
 
 #include "coordinate.h"
+#include "symbol.h"
 
 #include <iostream>
 #include <string>
+#include <string_view>
 
 /**
  * @brief Representation of C language tokens
+ *
+ * @details The token's string content is a view into a text buffer owned by the ::Lexer
  */
 class Token
 {
@@ -165,12 +169,22 @@ public:
 	/**
 	 * @brief Set the token's string content
 	 */
-	void set_string(std::string const &str) { m_string = str; }
+	void set_string(std::string_view str) { m_string = str; }
 
 	/**
 	 * @brief Return the token's string content
 	 */
-	std::string const &get_string() const { return m_string; }
+	std::string_view get_string() const { return m_string; }
+
+	/**
+	 * @brief Set the interned spelling of an identifier token
+	 */
+	void set_symbol(Symbol sym) { m_symbol = sym; }
+
+	/**
+	 * @brief Return the interned spelling of an identifier token
+	 */
+	Symbol get_symbol() const { return m_symbol; }
 
 	/**
 	 * @brief Print the token to an output stream
@@ -193,12 +207,13 @@ public:
 	bool is_type_qualifier() const;
 
 private:
-	std::string m_string;
+	std::string_view m_string;
 	union {
 		int m_int_constant;
 		double m_double_constant;
 	};
 	Id m_id;
+	Symbol m_symbol;
 	Coordinate m_coord;
 };
 
@@ -3,9 +3,11 @@
 
 #include "function_node.h"
 #include "serializable.h"
+#include "symbol.h"
 #include "symbol_table_owner.h"
 
 #include <algorithm>
+#include <unordered_set>
 #include <vector>
 
 class TransUnitNode
@@ -37,9 +39,9 @@ public:
 			f->constant_fold();
 	}
 
-	void add_string_literal(std::string const &str)
+	void add_string_literal(Symbol str)
 	{
-		if (std::find(m_string_literals.begin(), m_string_literals.end(), str) == m_string_literals.end())
+		if (m_string_literal_set.insert(str).second)
 			m_string_literals.push_back(str);
 	}
 
@@ -49,12 +51,13 @@ public:
 			m_floating_constants.push_back(d);
 	}
 
-	std::vector<std::string> const &get_string_literals() const { return m_string_literals; }
+	std::vector<Symbol> const &get_string_literals() const { return m_string_literals; }
 
 	std::vector<double> const &get_floating_constants() const { return m_floating_constants; }
 
 private:
-	std::vector<std::string> m_string_literals;
+	std::vector<Symbol> m_string_literals;	// in order of appearance
+	std::unordered_set<Symbol> m_string_literal_set;
 	std::vector<double> m_floating_constants;
 	std::vector<FunctionNode *> m_functions;
 };
@@ -1,7 +1,9 @@
 #include "type.h"
 #include "declaration.h"
 
+Arena Type::m_arena;
 std::vector<TypeTreeNode *> Type::m_pool;
+std::unordered_map<Type::Key, TypeTreeNode *, Type::KeyHash> Type::m_index;
 
 size_t Type::m_tag_cntr = 0;
 
@@ -45,10 +47,7 @@ Type Type::integer_promote() const
 
 Type Type::attach(TypeNode const &node) const
 {
-	for (auto c : m_ptr->get_children())
-		if (c->get_node() == node)
-			return c;
-	return new TypeTreeNode(node, m_ptr);
+	return find_or_create(node, m_ptr, false);
 }
 
 Type Type::replace_back_to(Type const &other) const
@@ -104,17 +103,25 @@ size_t Type::get_alignment_in_bytes() const
 }
 
 Type Type::install(TypeNode const &tn, bool as_new)
+{
+	return find_or_create(tn, nullptr, as_new);
+}
+
+TypeTreeNode *Type::find_or_create(TypeNode const &tn, TypeTreeNode *arg, bool as_new)
 {
 	if (!as_new)
 	{
-		for (auto c : m_pool)
-			if (c->get_node() == tn)
-				return c;
+		auto it = m_index.find(Key{&tn, arg});
+		if (it != m_index.end())
+			return it->second;
 	}
-	TypeTreeNode *c = new TypeTreeNode(tn);
+	TypeTreeNode *c = m_arena.create<TypeTreeNode>(tn, arg);
 	if (as_new && tn.get_id() == TypeNode::ENUM)
 		c->get_node().set_tag(c->get_node().get_tag() + ":" + std::to_string(++m_tag_cntr));
-	m_pool.push_back(c);
+	if (arg == nullptr)
+		m_pool.push_back(c);
+	// an equal node that is already indexed keeps shadowing the new one
+	m_index.emplace(Key{&c->get_node(), arg}, c);
 	return c;
 }
 
@@ -11,10 +11,14 @@
 #ifndef TYPE_H_INCLUDED
 #define TYPE_H_INCLUDED
 
+#include "arena.h"
 #include "serializable.h"
 #include "type_node.h"
 
+#include <functional>
 #include <iostream>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @brief Representation of C types and their operations
@@ -30,6 +34,11 @@
  * The Type class contains a pointer to the actual node in the type forest.
  * This choice makes type comparisons easy (comparing addresses), and allows
  * to modify types referenced by other types during compilation.
+ *
+ * The nodes of the forest are hash-consed: a hash table indexed by the
+ * contents of a node and its argument node finds existing types in constant
+ * time, so each distinct type is only built once.
+ * The nodes are allocated in an arena that is freed in one step by free_pool().
  */
 class Type
 	: public Serializable
@@ -54,13 +63,13 @@ public:
 	bool is_complete_object() const { return !is_incomplete() && is_object(); }
 
 	/** @brief Lookup the value of a symbol for an enumerated type */
-	int const *lookup_enum_constant(std::string const &id) const { return m_ptr->get_node().lookup_enum_constant(id); }
+	int const *lookup_enum_constant(Symbol id) const { return m_ptr->get_node().lookup_enum_constant(id); }
 
 	/** @brief Lookup the type of a field of a structure */
-	Type const *lookup_structure_field_type(std::string const &id) const { return m_ptr->get_node().lookup_structure_field_type(id); }
+	Type const *lookup_structure_field_type(Symbol id) const { return m_ptr->get_node().lookup_structure_field_type(id); }
 
 	/** @brief Lookup the offset of a structure's field */
-	size_t lookup_structure_field_offset(std::string const &id) const { return m_ptr->get_node().lookup_structure_field_offset(id); }
+	size_t lookup_structure_field_offset(Symbol id) const { return m_ptr->get_node().lookup_structure_field_offset(id); }
 
 	/** @brief Determine if the type is floating or not */
 	bool is_floating() const { return TypeNode::is_floating(m_ptr->get_node().get_id()); }
@@ -183,6 +192,9 @@ public:
 	/** @brief Determines if two types are different or not */
 	bool operator!=(Type const &other) const { return !(*this == other); }
 
+	/** @brief Returns a hash value of the type, consistent with operator== */
+	size_t hash() const { return std::hash<TypeTreeNode const *>()(m_ptr); }
+
 	/** @brief Determines the common real type of two arithmetic types */
 	Type common_real_type(Type const &other) const;
 
@@ -240,16 +252,17 @@ public:
 	static void print_pool(std::ostream &os);
 
 	/** @brief add a new enumeration constant to an enumerated type */
-	void add_enum_constant(std::string const &id, int val) { m_ptr->get_node().add_enum_constant(id, val); }
+	void add_enum_constant(Symbol id, int val) { m_ptr->get_node().add_enum_constant(id, val); }
 
 	/** @brief Add a new field to a structure type */
-	void add_field(std::string const &id, Type const &type) { m_ptr->get_node().add_field(id, type); }
+	void add_field(Symbol id, Type const &type) { m_ptr->get_node().add_field(id, type); }
 
 	/** @brief free the whole type forest (at the end of everything) */
 	static void free_pool()
 	{
-		for (auto s : m_pool)
-			delete s;
+		m_index.clear();
+		m_pool.clear();
+		m_arena.release();
 	}
 
 	/** @brief return a pointer to function type for function types */
@@ -271,11 +284,52 @@ public:
 private:
 	static int print_rec(TypeTreeNode *c, std::ostream &os);
 
+	/** @brief Key of the type index: a type node and the node it is attached to */
+	struct Key
+	{
+		TypeNode const *node;
+		TypeTreeNode const *arg;
+
+		bool operator==(Key const &other) const { return arg == other.arg && *node == *other.node; }
+	};
+
+	/** @brief Hash function of the type index */
+	struct KeyHash
+	{
+		size_t operator()(Key const &key) const
+		{
+			return key.node->hash() ^ (std::hash<TypeTreeNode const *>()(key.arg) * 31);
+		}
+	};
+
+	/**
+	 * @brief Find a node in the type forest or create it
+	 * @param tn the contents of the node
+	 * @param arg the node the new node is attached to, nullptr for roots
+	 * @param as_new forces that a new node should be created
+	 */
+	static TypeTreeNode *find_or_create(TypeNode const &tn, TypeTreeNode *arg, bool as_new);
+
 private:
 	TypeTreeNode *m_ptr;
+	/** @brief roots of the type forest */
 	static std::vector<TypeTreeNode *> m_pool;
+	/** @brief index of all nodes of the forest, the keys refer to the nodes themselves */
+	static std::unordered_map<Key, TypeTreeNode *, KeyHash> m_index;
+	/** @brief the arena owning all nodes of the forest */
+	static Arena m_arena;
 	static size_t m_tag_cntr;
 	static int m_label;
 };
 
+namespace std
+{
+	/** @brief Types are hashed by their node in the type forest */
+	template <>
+	struct hash<Type>
+	{
+		size_t operator()(Type const &type) const { return type.hash(); }
+	};
+}
+
 #endif
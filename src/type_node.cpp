@@ -148,7 +148,7 @@ void TypeNode::print(std::ostream &os, size_t level) const
 		for (size_t i = 0; i < m_n_declarations; ++i)
 		{
 			Declaration const &d = m_declarations[i];
-			if (d.get_identifier().size() != 0)
+			if (!d.get_identifier().empty())
 				os << d.get_identifier() << ": ";
 			os << d.get_type() << (i == m_n_declarations - 1 ? "" : ", ");
 		}
@@ -309,7 +309,29 @@ bool TypeNode::operator==(TypeNode const &other) const
 	return true;
 }
 
-void TypeNode::add_field(std::string const &id, Type const &type)
+size_t TypeNode::hash() const
+{
+	// only the members compared by operator== contribute to the hash
+	size_t h = std::hash<int>()(m_id);
+	auto combine = [&h](size_t v) { h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2); };
+	if (m_id == ARRAY)
+		combine(m_size);
+	if (m_id == FUNCTION)
+	{
+		combine(m_is_vararg);
+		combine(m_n_declarations);
+		for (size_t i = 0; i < m_n_declarations; ++i)
+		{
+			combine(std::hash<Type>()(m_declarations[i].get_type()));
+			combine(std::hash<Symbol>()(m_declarations[i].get_identifier()));
+		}
+	}
+	if (m_id == ENUM)
+		combine(std::hash<std::string>()(m_tag));
+	return h;
+}
+
+void TypeNode::add_field(Symbol id, Type const &type)
 {
 	if (get_id() != STRUCT)
 		throw __FILE__ ": Fields can only be added to structures";
@@ -333,7 +355,7 @@ void TypeNode::add_field(std::string const &id, Type const &type)
 	m_size = siz;
 }
 
-Type const *TypeNode::lookup_structure_field_type(std::string const &id) const
+Type const *TypeNode::lookup_structure_field_type(Symbol id) const
 {
 	if (get_id() != STRUCT)
 		throw __FILE__ ": Structure field lookup only valid for structure nodes";
@@ -343,7 +365,7 @@ Type const *TypeNode::lookup_structure_field_type(std::string const &id) const
 	return nullptr;
 }
 
-size_t TypeNode::lookup_structure_field_offset(std::string const &id) const
+size_t TypeNode::lookup_structure_field_offset(Symbol id) const
 {
 	if (get_id() != STRUCT)
 		throw __FILE__ ": Structure offset lookup only valid for structure nodes";
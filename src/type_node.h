@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "serializable.h"
+#include "symbol.h"
 
 class Declaration;
 class Type;
@@ -101,6 +102,9 @@ public:
 	/** @brief compares two type nodes for equality */
 	bool operator==(TypeNode const &other) const;
 
+	/** @brief returns a hash value of the type node, consistent with operator== */
+	size_t hash() const;
+
 	/** @brief compares two type nodes for difference */
 	bool operator!=(TypeNode const &other) const { return !(*this == other); }
 
@@ -228,14 +232,13 @@ public:
 		return false;
 	}
 
-	/** @brief add an enum constant to an enumerated type */
-	void add_enum_constant(std::string const &id, int val)
+	/** @brief add an enum constant to an enumerated type
+	 * @details duplicates are rejected by the parser, when the constant is installed into its scope
+	 */
+	void add_enum_constant(Symbol id, int val)
 	{
 		if (get_id() != ENUM)
 			throw __FILE__ ": Enum constants only valid for enum type nodes";
-		for (size_t i = 0; i < m_enum_constants.size(); ++i)
-			if (m_enum_constants[i].first == id)
-				throw __FILE__ ": Enum constant duplicate error";
 		// if a constant is added to the enum, it becomes complete, so its size and alignment is not zero anymore
 		m_size = size_in_bytes(TypeNode::INT);
 		m_alignment = size_in_bytes(TypeNode::INT);
@@ -243,10 +246,10 @@ public:
 	}
 
 	/** @brief add a field to a structure type */
-	void add_field(std::string const &id, Type const &type);
+	void add_field(Symbol id, Type const &type);
 
 	/** @brief Lookup an enumeration constant */
-	int const *lookup_enum_constant(std::string const &id) const
+	int const *lookup_enum_constant(Symbol id) const
 	{
 		if (get_id() != ENUM)
 			throw __FILE__ ": Enum constants only valid for enum type nodes";
@@ -257,10 +260,10 @@ public:
 	}
 
 	/** @brief Lookup a structure field's type */
-	Type const *lookup_structure_field_type(std::string const &id) const;
+	Type const *lookup_structure_field_type(Symbol id) const;
 
 	/** @brief Lookup a structure field's offset */
-	size_t lookup_structure_field_offset(std::string const &id) const;
+	size_t lookup_structure_field_offset(Symbol id) const;
 
 	/** @brief return the tag of a structure/enum type */
 	std::string const &get_tag() const
@@ -283,7 +286,7 @@ private:
 	size_t m_size;
 	size_t m_alignment;
 	Declaration *m_declarations;
-	std::vector<std::pair<std::string, int>> m_enum_constants;
+	std::vector<std::pair<Symbol, int>> m_enum_constants;
 	size_t m_n_declarations;
 	bool m_is_vararg;
 	std::string m_tag;
@@ -320,12 +323,6 @@ public:
 
 	TypeTreeNode const &operator=(TypeTreeNode const &other) = delete;
 
-	~TypeTreeNode()
-	{
-		for (auto c : m_children)
-			delete c;
-	}
-
 private:
 	TypeNode m_node;
 	TypeTreeNode *m_arg;
@@ -15,7 +15,7 @@ public:
 
 	XprNode *clone() override
 	{
-		XprNode *c = new UnaryXprNode(*this);
+		XprNode *c = create<UnaryXprNode>(*this);
 		for (size_t i = 0; i < get_num_subxprs(); ++i)
 			c->set_subxpr(i, get_subxpr(i)->clone());
 		return c;
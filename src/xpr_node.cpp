@@ -7,7 +7,7 @@ XprNode *XprNode::conditional_cast(XprNode *xpr, Type const &type)
 	if (xpr->get_xpr_type() != type)
 	{
 		XprNode *tmp = xpr;
-		xpr = new CastXprNode();
+		xpr = create<CastXprNode>();
 		xpr->set_xpr_type(type);
 		xpr->add_subxpr(tmp);
 	}
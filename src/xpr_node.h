@@ -122,7 +122,7 @@ public:
 	/** @brief deep-copy the expression */
 	virtual XprNode *clone()
 	{
-		XprNode *c = new XprNode(*this);
+		XprNode *c = create<XprNode>(*this);
 		for (size_t i = 0; i < get_num_subxprs(); ++i)
 			c->set_subxpr(i, get_subxpr(i)->clone());
 		return c;
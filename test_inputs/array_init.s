@@ -0,0 +1,79 @@
+	.data                            
+	.section .rodata                 
+	.bss                             
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load t to %r10
+	movq     $0, %r11                
+	imulq    $12, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,4), %r10     
+	movl     $1, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -24(%rbp), %r10          # load t to %r10
+	movq     $0, %r11                
+	imulq    $12, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,4), %r10     
+	movl     $2, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -24(%rbp), %r10          # load t to %r10
+	movq     $0, %r11                
+	imulq    $12, %r11               
+	addq     %r11, %r10              
+	movq     $2, %r11                
+	leaq     (%r10,%r11,4), %r10     
+	movl     $3, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -24(%rbp), %r10          # load t to %r10
+	movq     $1, %r11                
+	imulq    $12, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,4), %r10     
+	movl     $11, %r11d              
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -24(%rbp), %r10          # load t to %r10
+	movq     $1, %r11                
+	imulq    $12, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,4), %r10     
+	movl     $12, %r11d              
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -24(%rbp), %r10          # load t to %r10
+	movq     $1, %r11                
+	imulq    $12, %r11               
+	addq     %r11, %r10              
+	movq     $2, %r11                
+	leaq     (%r10,%r11,4), %r10     
+	movl     $13, %r11d              
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+.L1:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
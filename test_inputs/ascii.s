@@ -0,0 +1,102 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "%3d:%c  "              
+.L2:
+	.string  "\n"                    
+	.bss                             
+	.globl   printf                  
+	.align   0                       
+	.type    printf, @object         
+	.size    printf, 0               
+printf:
+	.zero    0                       
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $1, %rsp                 # alloc for automatic variables on stack
+	leaq     -1(%rbp), %r10           # load address of c into %r10
+	movl     $2, %r11d               
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+.L4:	# condition of FOR statement
+	movb     -1(%rbp), %r10b          # load c to %r10b
+	movzbl   %r10b, %r10d             # upcasting from %r10b to %r10d
+	movl     $8, %r11d               
+	cmpl     %r11d, %r10d            
+	jge      .L6                     
+	subq     $1, %rsp                 # alloc for automatic variables on stack
+	leaq     -2(%rbp), %r10           # load address of d into %r10
+	movl     $0, %r11d               
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+.L7:	# condition of FOR statement
+	movb     -2(%rbp), %r10b          # load d to %r10b
+	movzbl   %r10b, %r10d             # upcasting from %r10b to %r10d
+	movl     $16, %r11d              
+	cmpl     %r11d, %r10d            
+	jge      .L9                     
+	subq     $1, %rsp                 # alloc for automatic variables on stack
+	leaq     -3(%rbp), %r10           # load address of e into %r10
+	movl     $16, %r11d              
+	movb     -1(%rbp), %r12b          # load c to %r12b
+	movzbl   %r12b, %r12d             # upcasting from %r12b to %r12d
+	imull    %r12d, %r11d            
+	movb     -2(%rbp), %r12b          # load d to %r12b
+	movzbl   %r12b, %r12d             # upcasting from %r12b to %r12d
+	addl     %r12d, %r11d            
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+	subq     $13, %rsp                # Stack alignment before 64-bit function call
+	movb     -3(%rbp), %r10b          # load e to %r10b
+	movzbl   %r10b, %r10d             # upcasting from %r10b to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movb     -3(%rbp), %r10b          # load e to %r10b
+	movzbl   %r10b, %r10d             # upcasting from %r10b to %r10d
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $13, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	addq     $1, %rsp                 # remove automatic variables from stack
+.L8:	# step expression of FOR statement
+	movb     -2(%rbp), %r10b          # fetch result before in/decrement as expression value
+	addb     $1, -2(%rbp)             # ++ d  
+	jmp      .L7                     
+.L9:	# FOR statement done
+	subq     $14, %rsp                # Stack alignment before 64-bit function call
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $14, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	addq     $1, %rsp                 # remove automatic variables from stack
+.L5:	# step expression of FOR statement
+	addb     $1, -1(%rbp)             # ++ c  
+	movb     -1(%rbp), %r10b          # fetch in/decremented result as expression value
+	jmp      .L4                     
+.L6:	# FOR statement done
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $1, %rsp                 # rewind stack before jump
+.L3:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,29 @@
+	.data                            
+	.section .rodata                 
+	.bss                             
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+.L1:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,137 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "Meddig erdekelnek a Fibonacci-szamok?: "
+.L2:
+	.string  "%d"                    
+.L3:
+	.string  "F(%d) = %lld\n"        
+	.bss                             
+	.text                            
+	.globl   fibonacci               
+	.type    fibonacci, @function    
+fibonacci:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $4, %rsp                 # alloc for automatic variables on stack
+	movl     %edi, -4(%rbp)           # save n to stack
+	movl     %edi, %r10d              # load n to %r10d
+	movl     $1, %r11d               
+	cmpl     %r11d, %r10d            
+	jg       .L6                     
+	movl     -4(%rbp), %r10d          # load n to %r10d
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $4, %rsp                 # rewind stack before jump
+	jmp      .L4                     
+.L6:	# end of IF statement
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movl     -4(%rbp), %r10d          # load n to %r10d
+	movl     $2, %r11d               
+	subl     %r11d, %r10d            
+	movl     %r10d, %edi              # Move argument #0 to %edi
+	callq    fibonacci@PLT           
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $4, %rsp                 # Stack alignment before 64-bit function call
+	movl     -4(%rbp), %r10d          # load n to %r10d
+	movl     $1, %r11d               
+	subl     %r11d, %r10d            
+	movl     %r10d, %edi              # Move argument #0 to %edi
+	callq    fibonacci@PLT           
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	addq     %r11, %r10              
+	movq     %r10, %rax              
+	addq     $4, %rsp                 # rewind stack before jump
+.L4:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -4(%rbp), %r10           # load  &n to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -8(%rbp), %r10           # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L8:	# condition of FOR statement
+	movl     -8(%rbp), %r10d          # load i to %r10d
+	movl     -4(%rbp), %r11d          # load n to %r11d
+	cmpl     %r11d, %r10d            
+	jge      .L10                    
+	subq     $16, %rsp                # Stack alignment before 64-bit function call
+	movl     -8(%rbp), %r10d          # load i to %r10d
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fibonacci@PLT           
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     -8(%rbp), %r10d          # load i to %r10d
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L9:	# step expression of FOR statement
+	addl     $1, -8(%rbp)             # ++ i  
+	movl     -8(%rbp), %r10d          # fetch in/decremented result as expression value
+	jmp      .L8                     
+.L10:	# FOR statement done
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $8, %rsp                 # rewind stack before jump
+.L7:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
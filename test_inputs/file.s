@@ -0,0 +1,181 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "fajl.txt"              
+.L2:
+	.string  "wb"                    
+.L3:
+	.string  "Szevasz!"              
+.L4:
+	.string  "hanyat?: "             
+.L5:
+	.string  "%d"                    
+.L6:
+	.string  "%p: %d\n"              
+	.bss                             
+	.globl   free                    
+	.align   0                       
+	.type    free, @object           
+	.size    free, 0                 
+free:
+	.zero    0                       
+	.globl   malloc                  
+	.align   0                       
+	.type    malloc, @object         
+	.size    malloc, 0               
+malloc:
+	.zero    0                       
+	.globl   scanf                   
+	.align   0                       
+	.type    scanf, @object          
+	.size    scanf, 0                
+scanf:
+	.zero    0                       
+	.globl   fprintf                 
+	.align   0                       
+	.type    fprintf, @object        
+	.size    fprintf, 0              
+fprintf:
+	.zero    0                       
+	.globl   printf                  
+	.align   0                       
+	.type    printf, @object         
+	.size    printf, 0               
+printf:
+	.zero    0                       
+	.globl   fclose                  
+	.align   0                       
+	.type    fclose, @object         
+	.size    fclose, 0               
+fclose:
+	.zero    0                       
+	.globl   fopen                   
+	.align   0                       
+	.type    fopen, @object          
+	.size    fopen, 0                
+fopen:
+	.zero    0                       
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of f into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fopen@PLT               
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load f to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load f to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fclose@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L4(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -24(%rbp), %r10          # load  &n to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L5(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -16(%rbp), %r10          # load address of p into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movl     -24(%rbp), %r10d         # load n to %r10d
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     $4, %r11                
+	movq     %r10, %rax              
+	mulq     %r11                    
+	movq     %rax, %r10              
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -20(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L8:	# condition of FOR statement
+	movl     -20(%rbp), %r10d         # load i to %r10d
+	movl     -24(%rbp), %r11d         # load n to %r11d
+	cmpl     %r11d, %r10d            
+	jge      .L10                    
+	movq     -16(%rbp), %r10          # load p to %r10
+	movl     -20(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     -20(%rbp), %r11d         # load i to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load p to %r10
+	movl     -20(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     (%r10), %r10d           
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movq     -16(%rbp), %r10          # load p to %r10
+	movl     -20(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L6(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L9:	# step expression of FOR statement
+	addl     $1, -20(%rbp)            # ++ i  
+	movl     -20(%rbp), %r10d         # fetch in/decremented result as expression value
+	jmp      .L8                     
+.L10:	# FOR statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load p to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+.L7:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
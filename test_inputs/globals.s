@@ -0,0 +1,52 @@
+	.data                            
+	.section .rodata                 
+	.bss                             
+	.globl   c                       
+	.align   4                       
+	.type    c, @object              
+	.size    c, 16                   
+c:
+	.zero    16                      
+	.align   4                       
+	.type    korte, @object          
+	.size    korte, 4                
+korte:
+	.zero    4                       
+	.globl   alma                    
+	.align   4                       
+	.type    alma, @object           
+	.size    alma, 4                 
+alma:
+	.zero    4                       
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	leaq     alma(%rip), %r10         # load address of alma into %r10
+	movl     $1, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     korte(%rip), %r10        # load address of korte into %r10
+	movl     $2, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+.L1:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
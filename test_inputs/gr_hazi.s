@@ -0,0 +1,2528 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "r"                     
+.L2:
+	.string  "Nem siker�lt beolvasni a %s-t."
+.L3:
+	.string  "Nem siker�lt mem�ri�t foglalni a lista k�vetkez� elem�nek. (%s m�r nincs benne a list�ban, se az �t k�vet� emberek.) \n"
+.L4:
+	.string  "Nem siker�lt beolvasni az %s-t."
+.L5:
+	.string  "Nem siker�lt mem�ri�t foglalni a lista k�vetkez� elem�nek. (A %s m�r nincs benne a list�ban, se az �t k�vet� egyes�letek.)"
+.L6:
+	.string  "Ebben a v�rosban (%s) j�tsz� j�t�kosok, akik ekkor sz�lettek: %d\n"
+.L7:
+	.string  "%s\n"                  
+.L8:
+	.string  "Nincs olyan j�t�kos ebben a v�rosban (%s), aki ebben az �vben (%d) sz�letett volna."
+.L9:
+	.string  "%s ellen�k j�tszhatott:\n"
+.L10:
+	.string  "Ebben a v�rosban (%s) csak egy csapat van."
+.L11:
+	.string  "Nincs olyan j�t�kos, aki ebben az �vben (%d) sz�letett.\n"
+.L12:
+	.string  "Pr�b�ld nagy kezd�bet�vel!\n"
+.L13:
+	.string  "Nincs ebben a v�rosban (%s) sportegyes�let.\n"
+.L14:
+	.string  "Nincs %s nev� j�t�kos, aki ebben az �vben (%d) sz�letett volna."
+.L15:
+	.string  "Nincs %s nev� j�t�kos a list�ban."
+.L16:
+	.string  "T�bb %s nev� j�t�kos is van a list�ban."
+.L17:
+	.string  "default.txt"           
+.L18:
+	.string  "-h"                    
+.L19:
+	.string  "Haszn�lat: %s\n-j a j�t�kosokat tartalmaz� sz�veges f�jl neve a kiterjeszt�ssel egy�tt (pl.: -j jatekosok.txt) \n-e az egyes�leteket tartalmaz� sz�veges f�jl neve a kiterjeszt�ssel egy�tt"
+.L20:
+	.string  "-j"                    
+.L21:
+	.string  "-e"                    
+.L22:
+	.string  "Ismeretlen param�ter: %s"
+.L23:
+	.string  "Legal�bb az egyik f�jl neve nem volt a parancssori argumentumok k�z�tt."
+.L24:
+	.string  "Adj meg egy sz�let�si �vet: "
+.L25:
+	.string  "%d"                    
+.L26:
+	.string  "Egy sz�mot adj meg: "
+.L27:
+	.string  "Adj meg egy �j sz�let�si �vet: "
+.L28:
+	.string  "Adj meg egy v�rost: "
+.L29:
+	.string  "Add meg a v�rost �jra: "
+.L30:
+	.string  "\nAdj meg egy j�t�kost csupa nagy bet�vel: "
+.L31:
+	.string  "\nAdj meg egy m�sik j�t�kost: "
+.L32:
+	.string  "\nAdd meg %s sz�let�si �v�t: "
+.L33:
+	.string  "\nAdd meg %s sz�let�si �v�t �jra: "
+	.bss                             
+	.text                            
+	.globl   lezaro                  
+	.type    lezaro, @function       
+lezaro:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save string to stack
+	subq     $4, %rsp                 # alloc for automatic variables on stack
+	leaq     -12(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L35:	# condition of WHILE statement
+	movq     -8(%rbp), %r10           # load string to %r10
+	movl     -12(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11), %r10       
+	movb     (%r10), %r10b           
+	movzbl   %r10b, %r10d             # upcasting from %r10b to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L36                    
+	movq     -8(%rbp), %r10           # load string to %r10
+	movl     -12(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11), %r10       
+	movb     (%r10), %r10b           
+	movzbl   %r10b, %r10d             # upcasting from %r10b to %r10d
+	movl     $10, %r11d              
+	cmpl     %r11d, %r10d            
+	jne      .L38                    
+	movq     -8(%rbp), %r10           # load string to %r10
+	movl     -12(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11), %r10       
+	movl     $0, %r11d               
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+	jmp      .L36                    
+.L38:	# end of IF statement
+	movl     -12(%rbp), %r10d         # fetch result before in/decrement as expression value
+	addl     $1, -12(%rbp)            # ++ i  
+	jmp      .L35                    
+.L36:	# WHILE statement done
+	addq     $12, %rsp                # remove automatic variables from stack
+.L34:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   j_ureslista             
+	.type    j_ureslista, @function  
+j_ureslista:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of head into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     $176, %r10              
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L41                    
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+	jmp      .L39                    
+.L41:	# end of IF statement
+	leaq     -16(%rbp), %r10          # load address of tail into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     $176, %r10              
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load tail to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L43                    
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+	jmp      .L39                    
+.L43:	# end of IF statement
+	movq     -8(%rbp), %r10           # load head to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     -16(%rbp), %r11          # load tail to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load tail to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+.L39:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   j_fuzo                  
+	.type    j_fuzo, @function       
+j_fuzo:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $40, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	movq     %rsi, -16(%rbp)          # save jnev to stack
+	movq     %rdx, -24(%rbp)          # save jnem to stack
+	movl     %ecx, -28(%rbp)          # save jdob to stack
+	movq     %r8, -40(%rbp)           # save jegyesulet to stack
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     -56(%rbp), %r10          # load address of ujelem into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movq     $176, %r10              
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -56(%rbp), %r10          # load ujelem to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L46                    
+	movl     $1, %r10d               
+	negl     %r10d                   
+	movl     %r10d, %eax             
+	addq     $56, %rsp                # rewind stack before jump
+	jmp      .L44                    
+.L46:	# end of IF statement
+	movq     -56(%rbp), %r10          # load ujelem to %r10
+	addq     $0, %r10                 # Apply offset of member j
+	addq     $56, %r10                # Apply offset of member dob
+	movl     -28(%rbp), %r11d         # load jdob to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load jnev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -56(%rbp), %r10          # load ujelem to %r10
+	addq     $0, %r10                 # Apply offset of member j
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcpy@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load jnem to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -56(%rbp), %r10          # load ujelem to %r10
+	addq     $0, %r10                 # Apply offset of member j
+	addq     $51, %r10                # Apply offset of member nem
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcpy@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -40(%rbp), %r10          # load jegyesulet to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -56(%rbp), %r10          # load ujelem to %r10
+	addq     $0, %r10                 # Apply offset of member j
+	addq     $60, %r10                # Apply offset of member egyesulet_neve
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcpy@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	leaq     -48(%rbp), %r10          # load address of fuzo into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     -56(%rbp), %r11          # load ujelem to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -56(%rbp), %r10          # load ujelem to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     -48(%rbp), %r11          # load fuzo to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $56, %rsp                # rewind stack before jump
+.L44:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   jatekos_olvaso          
+	.type    jatekos_olvaso, @function
+jatekos_olvaso:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save fajlnev to stack
+	subq     $192, %rsp               # alloc for automatic variables on stack
+	leaq     -192(%rbp), %r10         # load address of fp into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load fajlnev to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fopen@PLT               
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -192(%rbp), %r10         # load fp to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L49                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load fajlnev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $200, %rsp               # rewind stack before jump
+	jmp      .L47                    
+.L49:	# end of IF statement
+	leaq     -200(%rbp), %r10         # load address of head into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	callq    j_ureslista@PLT         
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -200(%rbp), %r10         # load head to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L51                    
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $200, %rsp               # rewind stack before jump
+	jmp      .L47                    
+.L51:	# end of IF statement
+.L52:	# condition of WHILE statement
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -192(%rbp), %r10         # load fp to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $51, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -60(%rbp), %r10          # load nevek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L53                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -192(%rbp), %r10         # load fp to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $6, %r10d               
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -67(%rbp), %r10          # load nemek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L53                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -192(%rbp), %r10         # load fp to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $6, %r10d               
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -176(%rbp), %r10         # load evek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L53                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -192(%rbp), %r10         # load fp to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $100, %r10d             
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -169(%rbp), %r10         # load egyesuletek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L53                    
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -60(%rbp), %r10          # load nevek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    lezaro@PLT              
+	leaq     -67(%rbp), %r10          # load nemek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    lezaro@PLT              
+	leaq     -169(%rbp), %r10         # load egyesuletek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    lezaro@PLT              
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	leaq     -180(%rbp), %r10         # load address of ev into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	leaq     -176(%rbp), %r10         # load evek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    atoi@PLT                
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movl     %eax, %r11d              # move return value to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -204(%rbp), %r10         # load address of siker into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	leaq     -169(%rbp), %r10         # load egyesuletek to %r10
+	movq     %r10, %r8                # Move argument #4 to %r8
+	movl     -180(%rbp), %r10d        # load ev to %r10d
+	movl     %r10d, %ecx              # Move argument #3 to %ecx
+	leaq     -67(%rbp), %r10          # load nemek to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     -60(%rbp), %r10          # load nevek to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -200(%rbp), %r10         # load head to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    j_fuzo@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movl     %eax, %r11d              # move return value to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	movl     -204(%rbp), %r10d        # load siker to %r10d
+	movl     $1, %r11d               
+	negl     %r11d                   
+	cmpl     %r11d, %r10d            
+	jne      .L55                    
+	subq     $4, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -60(%rbp), %r10          # load nevek to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	addq     $4, %rsp                 # rewind stack before jump
+	jmp      .L53                    
+.L55:	# end of IF statement
+	addq     $4, %rsp                 # remove automatic variables from stack
+	jmp      .L52                    
+.L53:	# WHILE statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -192(%rbp), %r10         # load fp to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fclose@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     -200(%rbp), %r10         # load head to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	addq     $168, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L57                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -200(%rbp), %r10         # load head to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $200, %rsp               # rewind stack before jump
+	jmp      .L47                    
+.L57:	# end of IF statement
+	movq     -200(%rbp), %r10         # load head to %r10
+	movq     %r10, %rax              
+	addq     $200, %rsp               # rewind stack before jump
+.L47:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   j_free                  
+	.type    j_free, @function       
+j_free:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+.L59:	# condition of WHILE statement
+	movq     -8(%rbp), %r10           # load head to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L60                    
+	leaq     -16(%rbp), %r10          # load address of fogo into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	leaq     -8(%rbp), %r10           # load address of head into %r10
+	movq     -16(%rbp), %r11          # load fogo to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L59                    
+.L60:	# WHILE statement done
+	addq     $16, %rsp                # remove automatic variables from stack
+.L58:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   e_ureslista             
+	.type    e_ureslista, @function  
+e_ureslista:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of head into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     $160, %r10              
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L63                    
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+	jmp      .L61                    
+.L63:	# end of IF statement
+	leaq     -16(%rbp), %r10          # load address of tail into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     $160, %r10              
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load tail to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L65                    
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+	jmp      .L61                    
+.L65:	# end of IF statement
+	movq     -8(%rbp), %r10           # load head to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     -16(%rbp), %r11          # load tail to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load tail to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+.L61:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   e_fuzo                  
+	.type    e_fuzo, @function       
+e_fuzo:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	movq     %rsi, -16(%rbp)          # save enev to stack
+	movq     %rdx, -24(%rbp)          # save varos to stack
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     -40(%rbp), %r10          # load address of ujelem into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movq     $160, %r10              
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -40(%rbp), %r10          # load ujelem to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L68                    
+	movl     $1, %r10d               
+	negl     %r10d                   
+	movl     %r10d, %eax             
+	addq     $40, %rsp                # rewind stack before jump
+	jmp      .L66                    
+.L68:	# end of IF statement
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load enev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -40(%rbp), %r10          # load ujelem to %r10
+	addq     $0, %r10                 # Apply offset of member e
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcpy@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load varos to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -40(%rbp), %r10          # load ujelem to %r10
+	addq     $0, %r10                 # Apply offset of member e
+	addq     $101, %r10               # Apply offset of member szekhely
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcpy@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	leaq     -32(%rbp), %r10          # load address of fuzo into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     -40(%rbp), %r11          # load ujelem to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -40(%rbp), %r10          # load ujelem to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     -32(%rbp), %r11          # load fuzo to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $40, %rsp                # rewind stack before jump
+.L66:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   egyesulet_olvaso        
+	.type    egyesulet_olvaso, @function
+egyesulet_olvaso:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save fajlnev to stack
+	subq     $176, %rsp               # alloc for automatic variables on stack
+	leaq     -184(%rbp), %r10         # load address of fp into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load fajlnev to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fopen@PLT               
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -184(%rbp), %r10         # load fp to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L71                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load fajlnev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L4(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $184, %rsp               # rewind stack before jump
+	jmp      .L69                    
+.L71:	# end of IF statement
+	leaq     -176(%rbp), %r10         # load address of head into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	callq    e_ureslista@PLT         
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -176(%rbp), %r10         # load head to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L73                    
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $184, %rsp               # rewind stack before jump
+	jmp      .L69                    
+.L73:	# end of IF statement
+.L74:	# condition of WHILE statement
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -184(%rbp), %r10         # load fp to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $100, %r10d             
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -110(%rbp), %r10         # load nevek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L75                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -184(%rbp), %r10         # load fp to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $50, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -162(%rbp), %r10         # load varosok to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movq     %rax, %r10               # move return value to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L75                    
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -110(%rbp), %r10         # load nevek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    lezaro@PLT              
+	leaq     -162(%rbp), %r10         # load varosok to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    lezaro@PLT              
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	leaq     -188(%rbp), %r10         # load address of siker into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	leaq     -162(%rbp), %r10         # load varosok to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     -110(%rbp), %r10         # load nevek to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -176(%rbp), %r10         # load head to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    e_fuzo@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movl     %eax, %r11d              # move return value to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	movl     -188(%rbp), %r10d        # load siker to %r10d
+	movl     $1, %r11d               
+	negl     %r11d                   
+	cmpl     %r11d, %r10d            
+	jne      .L77                    
+	subq     $4, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -110(%rbp), %r10         # load nevek to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L5(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	addq     $4, %rsp                 # rewind stack before jump
+	jmp      .L75                    
+.L77:	# end of IF statement
+	addq     $4, %rsp                 # remove automatic variables from stack
+	jmp      .L74                    
+.L75:	# WHILE statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -184(%rbp), %r10         # load fp to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fclose@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     -176(%rbp), %r10         # load head to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	addq     $152, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L79                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -176(%rbp), %r10         # load head to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $184, %rsp               # rewind stack before jump
+	jmp      .L69                    
+.L79:	# end of IF statement
+	movq     -176(%rbp), %r10         # load head to %r10
+	movq     %r10, %rax              
+	addq     $184, %rsp               # rewind stack before jump
+.L69:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   e_free                  
+	.type    e_free, @function       
+e_free:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+.L81:	# condition of WHILE statement
+	movq     -8(%rbp), %r10           # load head to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L82                    
+	leaq     -16(%rbp), %r10          # load address of fogo into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	leaq     -8(%rbp), %r10           # load address of head into %r10
+	movq     -16(%rbp), %r11          # load fogo to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L81                    
+.L82:	# WHILE statement done
+	addq     $16, %rsp                # remove automatic variables from stack
+.L80:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   jatekos_avarosban       
+	.type    jatekos_avarosban, @function
+jatekos_avarosban:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $32, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save jhead to stack
+	movq     %rsi, -16(%rbp)          # save ehead to stack
+	movl     %edx, -20(%rbp)          # save ev to stack
+	movq     %rcx, -32(%rbp)          # save varos to stack
+	subq     $340, %rsp               # alloc for automatic variables on stack
+	leaq     -40(%rbp), %r10          # load address of nyomtat into %r10
+	movq     -8(%rbp), %r11           # load jhead to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -372(%rbp), %r10         # load address of szamlalo into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L84:	# condition of WHILE statement
+	movq     -40(%rbp), %r10          # load nyomtat to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L85                    
+	leaq     -204(%rbp), %r10         # load address of print into %r10
+	movq     -40(%rbp), %r11          # load nyomtat to %r11
+	addq     $0, %r11                 # Apply offset of member j
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     40(%r11), %r12          
+	movq     %r12, 40(%r10)          
+	movq     48(%r11), %r12          
+	movq     %r12, 48(%r10)          
+	movq     56(%r11), %r12          
+	movq     %r12, 56(%r10)          
+	movq     64(%r11), %r12          
+	movq     %r12, 64(%r10)          
+	movq     72(%r11), %r12          
+	movq     %r12, 72(%r10)          
+	movq     80(%r11), %r12          
+	movq     %r12, 80(%r10)          
+	movq     88(%r11), %r12          
+	movq     %r12, 88(%r10)          
+	movq     96(%r11), %r12          
+	movq     %r12, 96(%r10)          
+	movq     104(%r11), %r12         
+	movq     %r12, 104(%r10)         
+	movq     112(%r11), %r12         
+	movq     %r12, 112(%r10)         
+	movq     120(%r11), %r12         
+	movq     %r12, 120(%r10)         
+	movq     128(%r11), %r12         
+	movq     %r12, 128(%r10)         
+	movq     136(%r11), %r12         
+	movq     %r12, 136(%r10)         
+	movq     144(%r11), %r12         
+	movq     %r12, 144(%r10)         
+	movq     152(%r11), %r12         
+	movq     %r12, 152(%r10)         
+	movl     160(%r11), %r12d        
+	movl     %r12d, 160(%r10)        
+	leaq     -204(%rbp), %r10         # load print to %r10
+	addq     $56, %r10                # Apply offset of member dob
+	movl     (%r10), %r10d           
+	movl     -20(%rbp), %r11d         # load ev to %r11d
+	cmpl     %r11d, %r10d            
+	jne      .L87                    
+	leaq     -216(%rbp), %r10         # load address of egylet into %r10
+	movq     -16(%rbp), %r11          # load ehead to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -368(%rbp), %r10         # load address of jo into %r10
+	movq     -216(%rbp), %r11         # load egylet to %r11
+	addq     $0, %r11                 # Apply offset of member e
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     40(%r11), %r12          
+	movq     %r12, 40(%r10)          
+	movq     48(%r11), %r12          
+	movq     %r12, 48(%r10)          
+	movq     56(%r11), %r12          
+	movq     %r12, 56(%r10)          
+	movq     64(%r11), %r12          
+	movq     %r12, 64(%r10)          
+	movq     72(%r11), %r12          
+	movq     %r12, 72(%r10)          
+	movq     80(%r11), %r12          
+	movq     %r12, 80(%r10)          
+	movq     88(%r11), %r12          
+	movq     %r12, 88(%r10)          
+	movq     96(%r11), %r12          
+	movq     %r12, 96(%r10)          
+	movq     104(%r11), %r12         
+	movq     %r12, 104(%r10)         
+	movq     112(%r11), %r12         
+	movq     %r12, 112(%r10)         
+	movq     120(%r11), %r12         
+	movq     %r12, 120(%r10)         
+	movq     128(%r11), %r12         
+	movq     %r12, 128(%r10)         
+	movq     136(%r11), %r12         
+	movq     %r12, 136(%r10)         
+	movq     144(%r11), %r12         
+	movq     %r12, 144(%r10)         
+.L88:	# condition of WHILE statement
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	leaq     -368(%rbp), %r10         # load jo to %r10
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -204(%rbp), %r10         # load print to %r10
+	addq     $60, %r10                # Apply offset of member egyesulet_neve
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L89                    
+	movq     -216(%rbp), %r10         # load egylet to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L89                    
+	leaq     -216(%rbp), %r10         # load address of egylet into %r10
+	movq     -216(%rbp), %r11         # load egylet to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -368(%rbp), %r10         # load address of jo into %r10
+	movq     -216(%rbp), %r11         # load egylet to %r11
+	addq     $0, %r11                 # Apply offset of member e
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     40(%r11), %r12          
+	movq     %r12, 40(%r10)          
+	movq     48(%r11), %r12          
+	movq     %r12, 48(%r10)          
+	movq     56(%r11), %r12          
+	movq     %r12, 56(%r10)          
+	movq     64(%r11), %r12          
+	movq     %r12, 64(%r10)          
+	movq     72(%r11), %r12          
+	movq     %r12, 72(%r10)          
+	movq     80(%r11), %r12          
+	movq     %r12, 80(%r10)          
+	movq     88(%r11), %r12          
+	movq     %r12, 88(%r10)          
+	movq     96(%r11), %r12          
+	movq     %r12, 96(%r10)          
+	movq     104(%r11), %r12         
+	movq     %r12, 104(%r10)         
+	movq     112(%r11), %r12         
+	movq     %r12, 112(%r10)         
+	movq     120(%r11), %r12         
+	movq     %r12, 120(%r10)         
+	movq     128(%r11), %r12         
+	movq     %r12, 128(%r10)         
+	movq     136(%r11), %r12         
+	movq     %r12, 136(%r10)         
+	movq     144(%r11), %r12         
+	movq     %r12, 144(%r10)         
+	jmp      .L88                    
+.L89:	# WHILE statement done
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     -32(%rbp), %r10          # load varos to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -368(%rbp), %r10         # load jo to %r10
+	addq     $101, %r10               # Apply offset of member szekhely
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L91                    
+	movl     -372(%rbp), %r10d        # load szamlalo to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L93                    
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movl     -20(%rbp), %r10d         # load ev to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movq     -32(%rbp), %r10          # load varos to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L6(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L93:	# end of IF statement
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	leaq     -204(%rbp), %r10         # load print to %r10
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L7(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     -372(%rbp), %r10d        # fetch result before in/decrement as expression value
+	addl     $1, -372(%rbp)           # ++ szamlalo
+.L91:	# end of IF statement
+.L87:	# end of IF statement
+	leaq     -40(%rbp), %r10          # load address of nyomtat into %r10
+	movq     -40(%rbp), %r11          # load nyomtat to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L84                    
+.L85:	# WHILE statement done
+	movl     -372(%rbp), %r10d        # load szamlalo to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L95                    
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movl     -20(%rbp), %r10d         # load ev to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movq     -32(%rbp), %r10          # load varos to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L8(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L95:	# end of IF statement
+	addq     $372, %rsp               # remove automatic variables from stack
+.L83:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   versus                  
+	.type    versus, @function       
+versus:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save player to stack
+	movq     %rsi, -16(%rbp)          # save ehead to stack
+	movq     %rdx, -24(%rbp)          # save jhead to stack
+	subq     $336, %rsp               # alloc for automatic variables on stack
+	leaq     -28(%rbp), %r10          # load address of szamlalo into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -352(%rbp), %r10         # load address of q into %r10
+	movq     -16(%rbp), %r11          # load ehead to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -360(%rbp), %r10         # load address of p into %r10
+	movq     -24(%rbp), %r11          # load jhead to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -344(%rbp), %r10         # load address of jat into %r10
+	movq     -360(%rbp), %r11         # load p to %r11
+	addq     $0, %r11                 # Apply offset of member j
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     40(%r11), %r12          
+	movq     %r12, 40(%r10)          
+	movq     48(%r11), %r12          
+	movq     %r12, 48(%r10)          
+	movq     56(%r11), %r12          
+	movq     %r12, 56(%r10)          
+	movq     64(%r11), %r12          
+	movq     %r12, 64(%r10)          
+	movq     72(%r11), %r12          
+	movq     %r12, 72(%r10)          
+	movq     80(%r11), %r12          
+	movq     %r12, 80(%r10)          
+	movq     88(%r11), %r12          
+	movq     %r12, 88(%r10)          
+	movq     96(%r11), %r12          
+	movq     %r12, 96(%r10)          
+	movq     104(%r11), %r12         
+	movq     %r12, 104(%r10)         
+	movq     112(%r11), %r12         
+	movq     %r12, 112(%r10)         
+	movq     120(%r11), %r12         
+	movq     %r12, 120(%r10)         
+	movq     128(%r11), %r12         
+	movq     %r12, 128(%r10)         
+	movq     136(%r11), %r12         
+	movq     %r12, 136(%r10)         
+	movq     144(%r11), %r12         
+	movq     %r12, 144(%r10)         
+	movq     152(%r11), %r12         
+	movq     %r12, 152(%r10)         
+	movl     160(%r11), %r12d        
+	movl     %r12d, 160(%r10)        
+	leaq     -180(%rbp), %r10         # load address of egy into %r10
+	movq     -352(%rbp), %r11         # load q to %r11
+	addq     $0, %r11                 # Apply offset of member e
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     40(%r11), %r12          
+	movq     %r12, 40(%r10)          
+	movq     48(%r11), %r12          
+	movq     %r12, 48(%r10)          
+	movq     56(%r11), %r12          
+	movq     %r12, 56(%r10)          
+	movq     64(%r11), %r12          
+	movq     %r12, 64(%r10)          
+	movq     72(%r11), %r12          
+	movq     %r12, 72(%r10)          
+	movq     80(%r11), %r12          
+	movq     %r12, 80(%r10)          
+	movq     88(%r11), %r12          
+	movq     %r12, 88(%r10)          
+	movq     96(%r11), %r12          
+	movq     %r12, 96(%r10)          
+	movq     104(%r11), %r12         
+	movq     %r12, 104(%r10)         
+	movq     112(%r11), %r12         
+	movq     %r12, 112(%r10)         
+	movq     120(%r11), %r12         
+	movq     %r12, 120(%r10)         
+	movq     128(%r11), %r12         
+	movq     %r12, 128(%r10)         
+	movq     136(%r11), %r12         
+	movq     %r12, 136(%r10)         
+	movq     144(%r11), %r12         
+	movq     %r12, 144(%r10)         
+.L97:	# condition of WHILE statement
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load player to %r10
+	addq     $60, %r10                # Apply offset of member egyesulet_neve
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -180(%rbp), %r10         # load egy to %r10
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L98                    
+	leaq     -352(%rbp), %r10         # load address of q into %r10
+	movq     -352(%rbp), %r11         # load q to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -180(%rbp), %r10         # load address of egy into %r10
+	movq     -352(%rbp), %r11         # load q to %r11
+	addq     $0, %r11                 # Apply offset of member e
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     40(%r11), %r12          
+	movq     %r12, 40(%r10)          
+	movq     48(%r11), %r12          
+	movq     %r12, 48(%r10)          
+	movq     56(%r11), %r12          
+	movq     %r12, 56(%r10)          
+	movq     64(%r11), %r12          
+	movq     %r12, 64(%r10)          
+	movq     72(%r11), %r12          
+	movq     %r12, 72(%r10)          
+	movq     80(%r11), %r12          
+	movq     %r12, 80(%r10)          
+	movq     88(%r11), %r12          
+	movq     %r12, 88(%r10)          
+	movq     96(%r11), %r12          
+	movq     %r12, 96(%r10)          
+	movq     104(%r11), %r12         
+	movq     %r12, 104(%r10)         
+	movq     112(%r11), %r12         
+	movq     %r12, 112(%r10)         
+	movq     120(%r11), %r12         
+	movq     %r12, 120(%r10)         
+	movq     128(%r11), %r12         
+	movq     %r12, 128(%r10)         
+	movq     136(%r11), %r12         
+	movq     %r12, 136(%r10)         
+	movq     144(%r11), %r12         
+	movq     %r12, 144(%r10)         
+	jmp      .L97                    
+.L98:	# WHILE statement done
+	leaq     -352(%rbp), %r10         # load address of q into %r10
+	movq     -16(%rbp), %r11          # load ehead to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L99:	# condition of WHILE statement
+	movq     -352(%rbp), %r10         # load q to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L100                   
+.L101:	# condition of WHILE statement
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -352(%rbp), %r10         # load q to %r10
+	addq     $0, %r10                 # Apply offset of member e
+	addq     $101, %r10               # Apply offset of member szekhely
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -180(%rbp), %r10         # load egy to %r10
+	addq     $101, %r10               # Apply offset of member szekhely
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L102                   
+	movq     -352(%rbp), %r10         # load q to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L102                   
+	leaq     -352(%rbp), %r10         # load address of q into %r10
+	movq     -352(%rbp), %r11         # load q to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L101                   
+.L102:	# WHILE statement done
+	movq     -352(%rbp), %r10         # load q to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L104                   
+	jmp      .L100                   
+.L104:	# end of IF statement
+.L105:	# condition of WHILE statement
+	movq     -360(%rbp), %r10         # load p to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L106                   
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -352(%rbp), %r10         # load q to %r10
+	addq     $0, %r10                 # Apply offset of member e
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -344(%rbp), %r10         # load jat to %r10
+	addq     $60, %r10                # Apply offset of member egyesulet_neve
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L108                   
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load player to %r10
+	addq     $60, %r10                # Apply offset of member egyesulet_neve
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -344(%rbp), %r10         # load jat to %r10
+	addq     $60, %r10                # Apply offset of member egyesulet_neve
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L108                   
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load player to %r10
+	addq     $51, %r10                # Apply offset of member nem
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -344(%rbp), %r10         # load jat to %r10
+	addq     $51, %r10                # Apply offset of member nem
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L108                   
+	movq     -8(%rbp), %r10           # load player to %r10
+	addq     $56, %r10                # Apply offset of member dob
+	movl     (%r10), %r10d           
+	leaq     -344(%rbp), %r11         # load jat to %r11
+	addq     $56, %r11                # Apply offset of member dob
+	movl     (%r11), %r11d           
+	cmpl     %r11d, %r10d            
+	jne      .L108                   
+	movl     -28(%rbp), %r10d         # load szamlalo to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L110                   
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load player to %r10
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L9(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L110:	# end of IF statement
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -344(%rbp), %r10         # load jat to %r10
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L7(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     -28(%rbp), %r10d         # fetch result before in/decrement as expression value
+	addl     $1, -28(%rbp)            # ++ szamlalo
+.L108:	# end of IF statement
+	leaq     -360(%rbp), %r10         # load address of p into %r10
+	movq     -360(%rbp), %r11         # load p to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -344(%rbp), %r10         # load address of jat into %r10
+	movq     -360(%rbp), %r11         # load p to %r11
+	addq     $0, %r11                 # Apply offset of member j
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     40(%r11), %r12          
+	movq     %r12, 40(%r10)          
+	movq     48(%r11), %r12          
+	movq     %r12, 48(%r10)          
+	movq     56(%r11), %r12          
+	movq     %r12, 56(%r10)          
+	movq     64(%r11), %r12          
+	movq     %r12, 64(%r10)          
+	movq     72(%r11), %r12          
+	movq     %r12, 72(%r10)          
+	movq     80(%r11), %r12          
+	movq     %r12, 80(%r10)          
+	movq     88(%r11), %r12          
+	movq     %r12, 88(%r10)          
+	movq     96(%r11), %r12          
+	movq     %r12, 96(%r10)          
+	movq     104(%r11), %r12         
+	movq     %r12, 104(%r10)         
+	movq     112(%r11), %r12         
+	movq     %r12, 112(%r10)         
+	movq     120(%r11), %r12         
+	movq     %r12, 120(%r10)         
+	movq     128(%r11), %r12         
+	movq     %r12, 128(%r10)         
+	movq     136(%r11), %r12         
+	movq     %r12, 136(%r10)         
+	movq     144(%r11), %r12         
+	movq     %r12, 144(%r10)         
+	movq     152(%r11), %r12         
+	movq     %r12, 152(%r10)         
+	movl     160(%r11), %r12d        
+	movl     %r12d, 160(%r10)        
+	jmp      .L105                   
+.L106:	# WHILE statement done
+	leaq     -360(%rbp), %r10         # load address of p into %r10
+	movq     -24(%rbp), %r11          # load jhead to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -352(%rbp), %r10         # load address of q into %r10
+	movq     -352(%rbp), %r11         # load q to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L99                    
+.L100:	# WHILE statement done
+	movl     -28(%rbp), %r10d         # load szamlalo to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L112                   
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -180(%rbp), %r10         # load egy to %r10
+	addq     $101, %r10               # Apply offset of member szekhely
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L10(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L112:	# end of IF statement
+	addq     $360, %rsp               # remove automatic variables from stack
+.L96:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   benne_van               
+	.type    benne_van, @function    
+benne_van:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	movl     %esi, -12(%rbp)          # save ev to stack
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of h into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L114:	# condition of WHILE statement
+	movq     -24(%rbp), %r10          # load h to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L115                   
+	movq     -24(%rbp), %r10          # load h to %r10
+	addq     $0, %r10                 # Apply offset of member j
+	addq     $56, %r10                # Apply offset of member dob
+	movl     (%r10), %r10d           
+	movl     -12(%rbp), %r11d         # load ev to %r11d
+	cmpl     %r11d, %r10d            
+	jne      .L117                   
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+	jmp      .L113                   
+.L117:	# end of IF statement
+	leaq     -24(%rbp), %r10          # load address of h into %r10
+	movq     -24(%rbp), %r11          # load h to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L114                   
+.L115:	# WHILE statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movl     -12(%rbp), %r10d         # load ev to %r10d
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     .L11(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+.L113:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   benne_vanv              
+	.type    benne_vanv, @function   
+benne_vanv:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	movq     %rsi, -16(%rbp)          # save varos to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of egyes into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load varos to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11), %r10       
+	movb     (%r10), %r10b           
+	movzbl   %r10b, %r10d             # upcasting from %r10b to %r10d
+	movl     $122, %r11d             
+	cmpl     %r11d, %r10d            
+	jg       .L120                   
+	movq     -16(%rbp), %r10          # load varos to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11), %r10       
+	movb     (%r10), %r10b           
+	movzbl   %r10b, %r10d             # upcasting from %r10b to %r10d
+	movl     $97, %r11d              
+	cmpl     %r11d, %r10d            
+	jl       .L120                   
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L12(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+	jmp      .L118                   
+.L120:	# end of IF statement
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load varos to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    lezaro@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+.L121:	# condition of WHILE statement
+	movq     -24(%rbp), %r10          # load egyes to %r10
+	addq     $152, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L122                   
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load egyes to %r10
+	addq     $0, %r10                 # Apply offset of member e
+	addq     $101, %r10               # Apply offset of member szekhely
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load varos to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L124                   
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+	jmp      .L118                   
+.L124:	# end of IF statement
+	leaq     -24(%rbp), %r10          # load address of egyes into %r10
+	movq     -24(%rbp), %r11          # load egyes to %r11
+	addq     $152, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L121                   
+.L122:	# WHILE statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load varos to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L13(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+.L118:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   jatekos_kereso_mod      
+	.type    jatekos_kereso_mod, @function
+jatekos_kereso_mod:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $20, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save nev to stack
+	movq     %rsi, -16(%rbp)          # save head to stack
+	movl     %edx, -20(%rbp)          # save szulev to stack
+	leaq     -16(%rbp), %r10          # load address of head into %r10
+	movq     -16(%rbp), %r11          # load head to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load nev to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    lezaro@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+.L126:	# condition of WHILE statement
+	movq     -16(%rbp), %r10          # load head to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L127                   
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load head to %r10
+	addq     $0, %r10                 # Apply offset of member j
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load nev to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L129                   
+	movl     -20(%rbp), %r10d         # load szulev to %r10d
+	movq     -16(%rbp), %r11          # load head to %r11
+	addq     $0, %r11                 # Apply offset of member j
+	addq     $56, %r11                # Apply offset of member dob
+	movl     (%r11), %r11d           
+	cmpl     %r11d, %r10d            
+	jne      .L129                   
+	movq     -16(%rbp), %r10          # load head to %r10
+	movq     %r10, %rax              
+	addq     $20, %rsp                # rewind stack before jump
+	jmp      .L125                   
+.L129:	# end of IF statement
+	leaq     -16(%rbp), %r10          # load address of head into %r10
+	movq     -16(%rbp), %r11          # load head to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L126                   
+.L127:	# WHILE statement done
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movl     -20(%rbp), %r10d         # load szulev to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movq     -8(%rbp), %r10           # load nev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L14(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $20, %rsp                # rewind stack before jump
+.L125:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   jatekos_kereso          
+	.type    jatekos_kereso, @function
+jatekos_kereso:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save nev to stack
+	movq     %rsi, -16(%rbp)          # save head to stack
+	movq     %rdx, -24(%rbp)          # save szamlal to stack
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	leaq     -36(%rbp), %r10          # load address of szamlalo into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -16(%rbp), %r10          # load address of head into %r10
+	movq     -16(%rbp), %r11          # load head to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load nev to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    lezaro@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+.L131:	# condition of WHILE statement
+	movq     -16(%rbp), %r10          # load head to %r10
+	addq     $168, %r10               # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L132                   
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load head to %r10
+	addq     $0, %r10                 # Apply offset of member j
+	addq     $0, %r10                 # Apply offset of member nev
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load nev to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L134                   
+	movl     -36(%rbp), %r10d         # fetch result before in/decrement as expression value
+	addl     $1, -36(%rbp)            # ++ szamlalo
+	leaq     -32(%rbp), %r10          # load address of keresett into %r10
+	movq     -16(%rbp), %r11          # load head to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L134:	# end of IF statement
+	leaq     -16(%rbp), %r10          # load address of head into %r10
+	movq     -16(%rbp), %r11          # load head to %r11
+	addq     $168, %r11               # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L131                   
+.L132:	# WHILE statement done
+	movq     -24(%rbp), %r10          # load szamlal to %r10
+	movl     -36(%rbp), %r11d         # load szamlalo to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	movl     -36(%rbp), %r10d         # load szamlalo to %r10d
+	movl     $1, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L136                   
+	movq     -32(%rbp), %r10          # load keresett to %r10
+	movq     %r10, %rax              
+	addq     $36, %rsp                # rewind stack before jump
+	jmp      .L130                   
+.L136:	# end of IF statement
+	movl     -36(%rbp), %r10d         # load szamlalo to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L138                   
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load nev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L15(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L138:	# end of IF statement
+	movl     -36(%rbp), %r10d         # load szamlalo to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L140                   
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load nev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L16(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L140:	# end of IF statement
+	movl     $0, %r10d               
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     %r10, %rax              
+	addq     $36, %rsp                # rewind stack before jump
+.L130:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movl     %edi, -4(%rbp)           # save argc to stack
+	movq     %rsi, -16(%rbp)          # save argv to stack
+	subq     $160, %rsp               # alloc for automatic variables on stack
+	leaq     -40(%rbp), %r10          # load address of jfajl into %r10
+	leaq     .L17(%rip), %r11        
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -48(%rbp), %r10          # load address of efajl into %r10
+	leaq     .L17(%rip), %r11        
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -24(%rbp), %r10          # load address of i into %r10
+	movl     $1, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L142:	# condition of FOR statement
+	movl     -24(%rbp), %r10d         # load i to %r10d
+	movl     -4(%rbp), %r11d          # load argc to %r11d
+	cmpl     %r11d, %r10d            
+	jge      .L144                   
+	leaq     .L18(%rip), %r10        
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load argv to %r10
+	movl     -24(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     (%r10), %r10            
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L145                   
+	movq     -16(%rbp), %r10          # load argv to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     (%r10), %r10            
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L19(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $176, %rsp               # rewind stack before jump
+	jmp      .L141                   
+.L145:	# else branch of IF statement
+	leaq     .L20(%rip), %r10        
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load argv to %r10
+	movl     -24(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     (%r10), %r10            
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L147                   
+	leaq     -40(%rbp), %r10          # load address of jfajl into %r10
+	movq     -16(%rbp), %r11          # load argv to %r11
+	addl     $1, -24(%rbp)            # ++ i  
+	movl     -24(%rbp), %r12d         # fetch in/decremented result as expression value
+	movslq   %r12d, %r12              # upcasting from %r12d to %r12
+	leaq     (%r11,%r12,8), %r11     
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L148                   
+.L147:	# else branch of IF statement
+	leaq     .L21(%rip), %r10        
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load argv to %r10
+	movl     -24(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     (%r10), %r10            
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L149                   
+	leaq     -48(%rbp), %r10          # load address of efajl into %r10
+	movq     -16(%rbp), %r11          # load argv to %r11
+	addl     $1, -24(%rbp)            # ++ i  
+	movl     -24(%rbp), %r12d         # fetch in/decremented result as expression value
+	movslq   %r12d, %r12              # upcasting from %r12d to %r12
+	leaq     (%r11,%r12,8), %r11     
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L150                   
+.L149:	# else branch of IF statement
+	movq     -16(%rbp), %r10          # load argv to %r10
+	movl     -24(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     (%r10), %r10            
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L22(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r10d               
+	negl     %r10d                   
+	movl     %r10d, %eax             
+	addq     $176, %rsp               # rewind stack before jump
+	jmp      .L141                   
+.L150:	# end of IF statement
+.L148:	# end of IF statement
+.L146:	# end of IF statement
+.L143:	# step expression of FOR statement
+	movl     -24(%rbp), %r10d         # fetch result before in/decrement as expression value
+	addl     $1, -24(%rbp)            # ++ i  
+	jmp      .L142                   
+.L144:	# FOR statement done
+	leaq     .L17(%rip), %r10        
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -48(%rbp), %r10          # load efajl to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L155                   
+	movl     $0, %r10d               
+	jmp      .L156                   
+.L155:
+	movl     $1, %r10d               
+.L156:
+	testl    %r10d, %r10d            
+	jnz      .L153                   
+	leaq     .L17(%rip), %r10        
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -40(%rbp), %r10          # load jfajl to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L157                   
+	movl     $0, %r10d               
+	jmp      .L158                   
+.L157:
+	movl     $1, %r10d               
+.L158:
+	testl    %r10d, %r10d            
+	jnz      .L153                   
+	movl     $0, %r10d               
+	jmp      .L154                   
+.L153:
+	movl     $1, %r10d               
+.L154:
+	testl    %r10d, %r10d            
+	jz       .L152                   
+	leaq     .L23(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r10d               
+	negl     %r10d                   
+	movl     %r10d, %eax             
+	addq     $176, %rsp               # rewind stack before jump
+	jmp      .L141                   
+.L152:	# end of IF statement
+	leaq     -168(%rbp), %r10         # load address of jhead into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -40(%rbp), %r10          # load jfajl to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    jatekos_olvaso@PLT      
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L160                   
+	movl     $1, %r10d               
+	negl     %r10d                   
+	movl     %r10d, %eax             
+	addq     $176, %rsp               # rewind stack before jump
+	jmp      .L141                   
+.L160:	# end of IF statement
+	leaq     -176(%rbp), %r10         # load address of ehead into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -48(%rbp), %r10          # load efajl to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    egyesulet_olvaso@PLT    
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -176(%rbp), %r10         # load ehead to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L162                   
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    j_free@PLT              
+	movl     $1, %r10d               
+	negl     %r10d                   
+	movl     %r10d, %eax             
+	addq     $176, %rsp               # rewind stack before jump
+	jmp      .L141                   
+.L162:	# end of IF statement
+	leaq     .L24(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+.L163:	# condition of WHILE statement
+	leaq     -28(%rbp), %r10          # load  &ev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L25(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L164                   
+	leaq     .L26(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     stdin(%rip), %r10        # load stdin to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fflush@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	jmp      .L163                   
+.L164:	# WHILE statement done
+	movq     stdin(%rip), %r10        # load stdin to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fflush@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+.L165:	# condition of WHILE statement
+	movl     -28(%rbp), %r10d         # load ev to %r10d
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    benne_van@PLT           
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L166                   
+	leaq     .L27(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -28(%rbp), %r10          # load  &ev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L25(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     stdin(%rip), %r10        # load stdin to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fflush@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	jmp      .L165                   
+.L166:	# WHILE statement done
+	leaq     .L28(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     stdin(%rip), %r10        # load stdin to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $50, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -100(%rbp), %r10         # load varos to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	movq     %rax, %r10               # move return value to %r10
+.L167:	# condition of WHILE statement
+	leaq     -100(%rbp), %r10         # load varos to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -176(%rbp), %r10         # load ehead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    benne_vanv@PLT          
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L168                   
+	leaq     .L29(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     stdin(%rip), %r10        # load stdin to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $50, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -100(%rbp), %r10         # load varos to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	movq     %rax, %r10               # move return value to %r10
+	jmp      .L167                   
+.L168:	# WHILE statement done
+	leaq     -100(%rbp), %r10         # load varos to %r10
+	movq     %r10, %rcx               # Move argument #3 to %rcx
+	movl     -28(%rbp), %r10d         # load ev to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movq     -176(%rbp), %r10         # load ehead to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    jatekos_avarosban@PLT   
+	leaq     .L30(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     stdin(%rip), %r10        # load stdin to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $50, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -152(%rbp), %r10         # load jatek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	movq     %rax, %r10               # move return value to %r10
+	leaq     -160(%rbp), %r10         # load address of ptr into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -20(%rbp), %r10          # load  &szamlalo to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -152(%rbp), %r10         # load jatek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    jatekos_kereso@PLT      
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L169:	# condition of WHILE statement
+	movq     -160(%rbp), %r10         # load ptr to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L170                   
+	movl     -20(%rbp), %r10d         # load szamlalo to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L170                   
+	leaq     .L31(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     stdin(%rip), %r10        # load stdin to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $50, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -152(%rbp), %r10         # load jatek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fgets@PLT               
+	movq     %rax, %r10               # move return value to %r10
+	leaq     -160(%rbp), %r10         # load address of ptr into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -20(%rbp), %r10          # load  &szamlalo to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -152(%rbp), %r10         # load jatek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    jatekos_kereso@PLT      
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L169                   
+.L170:	# WHILE statement done
+	movq     -160(%rbp), %r10         # load ptr to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L172                   
+	movl     -20(%rbp), %r10d         # load szamlalo to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L172                   
+	leaq     -152(%rbp), %r10         # load jatek to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L32(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -28(%rbp), %r10          # load  &ev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L25(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -160(%rbp), %r10         # load address of ptr into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movl     -28(%rbp), %r10d         # load ev to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -152(%rbp), %r10         # load jatek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    jatekos_kereso_mod@PLT  
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L173:	# condition of WHILE statement
+	movq     -160(%rbp), %r10         # load ptr to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L174                   
+	leaq     -152(%rbp), %r10         # load jatek to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L33(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -28(%rbp), %r10          # load  &ev to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L25(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -160(%rbp), %r10         # load address of ptr into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movl     -28(%rbp), %r10d         # load ev to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     -152(%rbp), %r10         # load jatek to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    jatekos_kereso_mod@PLT  
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L173                   
+.L174:	# WHILE statement done
+.L172:	# end of IF statement
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rsi               # Move argument #2 to %rsi
+	movq     -176(%rbp), %r10         # load ehead to %r10
+	movq     %r10, %rdi               # Move argument #1 to %rdi
+	movq     -160(%rbp), %r10         # load ptr to %r10
+	addq     $0, %r10                 # Apply offset of member j
+	pushq    %r10                     # Push argument #0
+	callq    versus@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movq     -168(%rbp), %r10         # load jhead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    j_free@PLT              
+	movq     -176(%rbp), %r10         # load ehead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    e_free@PLT              
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $176, %rsp               # rewind stack before jump
+.L141:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,519 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "The trapped knight\n"  
+.L2:
+	.string  "Enter the starting coordinates:\n"
+.L3:
+	.string  "%ld%ld"                
+.L4:
+	.string  "The knight starts from (%ld,%ld)\n"
+.L5:
+	.string  "Step %2lu: Jumped to (%ld,%ld)\n"
+.L6:
+	.string  "stuck at (%ld, %ld) :(\n"
+	.bss                             
+	.text                            
+	.globl   is_inside               
+	.type    is_inside, @function    
+is_inside:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save x to stack
+	movq     %rsi, -16(%rbp)          # save y to stack
+	movq     -8(%rbp), %r10           # load x to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jge      .L10                    
+	movl     $0, %r10d               
+	jmp      .L11                    
+.L10:
+	movl     $1, %r10d               
+.L11:
+	testl    %r10d, %r10d            
+	jz       .L8                     
+	movq     -8(%rbp), %r10           # load x to %r10
+	movl     $8, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jl       .L12                    
+	movl     $0, %r10d               
+	jmp      .L13                    
+.L12:
+	movl     $1, %r10d               
+.L13:
+	testl    %r10d, %r10d            
+	jz       .L8                     
+	movq     -16(%rbp), %r10          # load y to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jge      .L14                    
+	movl     $0, %r10d               
+	jmp      .L15                    
+.L14:
+	movl     $1, %r10d               
+.L15:
+	testl    %r10d, %r10d            
+	jz       .L8                     
+	movq     -16(%rbp), %r10          # load y to %r10
+	movl     $8, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jl       .L16                    
+	movl     $0, %r10d               
+	jmp      .L17                    
+.L16:
+	movl     $1, %r10d               
+.L17:
+	testl    %r10d, %r10d            
+	jz       .L8                     
+	movl     $1, %r10d               
+	jmp      .L9                     
+.L8:
+	movl     $0, %r10d               
+.L9:
+	movl     %r10d, %eax             
+	addq     $16, %rsp                # rewind stack before jump
+.L7:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   can_move                
+	.type    can_move, @function     
+can_move:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save x to stack
+	movq     %rsi, -16(%rbp)          # save y to stack
+	movq     %rdx, -24(%rbp)          # save was_there to stack
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load y to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load x to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    is_inside@PLT           
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	testl    %r10d, %r10d            
+	jz       .L19                    
+	movq     -24(%rbp), %r10          # load was_there to %r10
+	movl     $8, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     -8(%rbp), %r12           # load x to %r12
+	imulq    %r12, %r11              
+	movq     -16(%rbp), %r12          # load y to %r12
+	addq     %r12, %r11              
+	leaq     (%r10,%r11,4), %r10     
+	movl     (%r10), %r10d           
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L21                    
+	movl     $0, %r10d               
+	jmp      .L22                    
+.L21:
+	movl     $1, %r10d               
+.L22:
+	testl    %r10d, %r10d            
+	jz       .L19                    
+	movl     $1, %r10d               
+	jmp      .L20                    
+.L19:
+	movl     $0, %r10d               
+.L20:
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+.L18:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $416, %rsp               # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of x into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -16(%rbp), %r10          # load address of y into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $0, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $2, %r11d               
+	negl     %r11d                   
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $0, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	negl     %r11d                   
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $1, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $2, %r11d               
+	negl     %r11d                   
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $1, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $2, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	negl     %r11d                   
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $2, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $2, %r11d               
+	negl     %r11d                   
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $3, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	negl     %r11d                   
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $3, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $2, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $4, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $4, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $2, %r11d               
+	negl     %r11d                   
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $5, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $5, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $2, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $6, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $2, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $6, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	negl     %r11d                   
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $7, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $0, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $2, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -144(%rbp), %r10         # load moves to %r10
+	movq     $7, %r11                
+	imulq    $16, %r11               
+	addq     %r11, %r10              
+	movq     $1, %r11                
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -160(%rbp), %r10         # load address of cntr into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -152(%rbp), %r10         # load address of i into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L24:	# condition of FOR statement
+	movq     -152(%rbp), %r10         # load i to %r10
+	movl     $8, %r11d               
+	movl     $8, %r12d               
+	imull    %r12d, %r11d            
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jae      .L26                    
+	leaq     -416(%rbp), %r10         # load was_there to %r10
+	movq     -152(%rbp), %r11         # load i to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L25:	# step expression of FOR statement
+	addq     $1, -152(%rbp)           # ++ i  
+	movq     -152(%rbp), %r10         # fetch in/decremented result as expression value
+	jmp      .L24                    
+.L26:	# FOR statement done
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -16(%rbp), %r10          # load  &y to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     -8(%rbp), %r10           # load  &x to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     -16(%rbp), %r10          # load y to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movq     -8(%rbp), %r10           # load x to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L4(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -416(%rbp), %r10         # load was_there to %r10
+	movl     $8, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     -8(%rbp), %r12           # load x to %r12
+	imulq    %r12, %r11              
+	movq     -16(%rbp), %r12          # load y to %r12
+	addq     %r12, %r11              
+	leaq     (%r10,%r11,4), %r10     
+	movl     $1, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L27:	# condition of WHILE statement
+	movl     $1, %r10d               
+	testl    %r10d, %r10d            
+	jz       .L28                    
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -424(%rbp), %r10         # load address of s into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L29:	# condition of FOR statement
+	movq     -424(%rbp), %r10         # load s to %r10
+	movl     $8, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jae      .L31                    
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	leaq     -432(%rbp), %r10         # load address of p into %r10
+	leaq     -144(%rbp), %r11         # load moves to %r11
+	movq     -424(%rbp), %r12         # load s to %r12
+	imulq    $16, %r12               
+	addq     %r12, %r11              
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -440(%rbp), %r10         # load address of x_to into %r10
+	movq     -8(%rbp), %r11           # load x to %r11
+	movq     -432(%rbp), %r12         # load p to %r12
+	movl     $0, %r13d               
+	movslq   %r13d, %r13              # upcasting from %r13d to %r13
+	leaq     (%r12,%r13,8), %r12     
+	movq     (%r12), %r12            
+	addq     %r12, %r11              
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -448(%rbp), %r10         # load address of y_to into %r10
+	movq     -16(%rbp), %r11          # load y to %r11
+	movq     -432(%rbp), %r12         # load p to %r12
+	movl     $1, %r13d               
+	movslq   %r13d, %r13              # upcasting from %r13d to %r13
+	leaq     (%r12,%r13,8), %r12     
+	movq     (%r12), %r12            
+	addq     %r12, %r11              
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -416(%rbp), %r10         # load was_there to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movq     -448(%rbp), %r10         # load y_to to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -440(%rbp), %r10         # load x_to to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    can_move@PLT            
+	movl     %eax, %r10d              # move return value to %r10d
+	testl    %r10d, %r10d            
+	jz       .L33                    
+	leaq     -8(%rbp), %r10           # load address of x into %r10
+	movq     -440(%rbp), %r11         # load x_to to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -16(%rbp), %r10          # load address of y into %r10
+	movq     -448(%rbp), %r11         # load y_to to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -416(%rbp), %r10         # load was_there to %r10
+	movl     $8, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     -8(%rbp), %r12           # load x to %r12
+	imulq    %r12, %r11              
+	movq     -16(%rbp), %r12          # load y to %r12
+	addq     %r12, %r11              
+	leaq     (%r10,%r11,4), %r10     
+	movl     $1, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	addq     $1, -160(%rbp)           # ++ cntr
+	movq     -160(%rbp), %r10         # fetch in/decremented result as expression value
+	movq     -16(%rbp), %r10          # load y to %r10
+	movq     %r10, %rcx               # Move argument #3 to %rcx
+	movq     -8(%rbp), %r10           # load x to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movq     -160(%rbp), %r10         # load cntr to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L5(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	addq     $24, %rsp                # rewind stack before jump
+	jmp      .L31                    
+.L33:	# end of IF statement
+	addq     $24, %rsp                # remove automatic variables from stack
+.L30:	# step expression of FOR statement
+	addq     $1, -424(%rbp)           # ++ s  
+	movq     -424(%rbp), %r10         # fetch in/decremented result as expression value
+	jmp      .L29                    
+.L31:	# FOR statement done
+	movq     -424(%rbp), %r10         # load s to %r10
+	movl     $8, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L35                    
+	addq     $8, %rsp                 # rewind stack before jump
+	jmp      .L28                    
+.L35:	# end of IF statement
+	addq     $8, %rsp                 # remove automatic variables from stack
+	jmp      .L27                    
+.L28:	# WHILE statement done
+	movq     -16(%rbp), %r10          # load y to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movq     -8(%rbp), %r10           # load x to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L6(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $416, %rsp               # rewind stack before jump
+.L23:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
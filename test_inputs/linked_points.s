@@ -0,0 +1,194 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "(%f %f)"               
+	.bss                             
+	.text                            
+	.globl   print_point             
+	.type    print_point, @function  
+print_point:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save p to stack
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $8, %r10                 # Apply offset of member y
+	movsd    (%r10), %xmm15          
+	movsd    %xmm15, %xmm1            # Move argument #2 to %xmm1
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $0, %r10                 # Apply offset of member x
+	movsd    (%r10), %xmm15          
+	movsd    %xmm15, %xmm0            # Move argument #1 to %xmm0
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $2, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	addq     $8, %rsp                 # remove automatic variables from stack
+.L2:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   new_point_elem          
+	.type    new_point_elem, @function
+new_point_elem:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movsd    %xmm0, -8(%rbp)          # save x to stack
+	movsd    %xmm1, -16(%rbp)         # save y to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of q into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movq     $24, %r10               
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -24(%rbp), %r10          # load q to %r10
+	addq     $0, %r10                 # Apply offset of member p
+	addq     $0, %r10                 # Apply offset of member x
+	movsd    -8(%rbp), %xmm15         # load x to %xmm15
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	movq     -24(%rbp), %r10          # load q to %r10
+	addq     $0, %r10                 # Apply offset of member p
+	addq     $8, %r10                 # Apply offset of member y
+	movsd    -16(%rbp), %xmm15        # load y to %xmm15
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	movq     -24(%rbp), %r10          # load q to %r10
+	addq     $16, %r10                # Apply offset of member next
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -24(%rbp), %r10          # load q to %r10
+	movq     %r10, %rax              
+	addq     $24, %rsp                # rewind stack before jump
+.L3:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of p into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -12(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L5:	# condition of FOR statement
+	movl     -12(%rbp), %r10d         # load i to %r10d
+	movl     $1000, %r11d            
+	cmpl     %r11d, %r10d            
+	jge      .L7                     
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of q into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movl     -12(%rbp), %r10d         # load i to %r10d
+	negl     %r10d                   
+	cvtsi2sd %r10d, %xmm15           
+	movsd    %xmm15, %xmm1            # Move argument #1 to %xmm1
+	movl     -12(%rbp), %r10d         # load i to %r10d
+	cvtsi2sd %r10d, %xmm15           
+	movsd    %xmm15, %xmm0            # Move argument #0 to %xmm0
+	callq    new_point_elem@PLT      
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -24(%rbp), %r10          # load q to %r10
+	addq     $16, %r10                # Apply offset of member next
+	movq     -8(%rbp), %r11           # load p to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -8(%rbp), %r10           # load address of p into %r10
+	movq     -24(%rbp), %r11          # load q to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	addq     $12, %rsp                # remove automatic variables from stack
+.L6:	# step expression of FOR statement
+	addl     $1, -12(%rbp)            # ++ i  
+	movl     -12(%rbp), %r10d         # fetch in/decremented result as expression value
+	jmp      .L5                     
+.L7:	# FOR statement done
+.L8:	# condition of WHILE statement
+	movq     -8(%rbp), %r10           # load p to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L9                     
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of q into %r10
+	movq     -8(%rbp), %r11           # load p to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load q to %r10
+	addq     $0, %r10                 # Apply offset of member p
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    print_point@PLT         
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	leaq     -8(%rbp), %r10           # load address of p into %r10
+	movq     -24(%rbp), %r11          # load q to %r11
+	addq     $16, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load q to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	addq     $20, %rsp                # Stack realignment after 64-bit function call
+	jmp      .L8                     
+.L9:	# WHILE statement done
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $12, %rsp                # rewind stack before jump
+.L4:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,104 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "%d%d%d%d%d%d%d%d"      
+.L2:
+	.string  "%d "                   
+	.bss                             
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $56, %rsp                # alloc for automatic variables on stack
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movl     $7, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	pushq    %r10                     # Push argument #8
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movl     $6, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	pushq    %r10                     # Push argument #7
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movl     $5, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	pushq    %r10                     # Push argument #6
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movl     $4, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movq     %r10, %r9                # Move argument #5 to %r9
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movl     $3, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movq     %r10, %r8                # Move argument #4 to %r8
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movl     $2, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movq     %r10, %rcx               # Move argument #3 to %rcx
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -44(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L4:	# condition of FOR statement
+	movl     -44(%rbp), %r10d         # load i to %r10d
+	movl     $8, %r11d               
+	cmpl     %r11d, %r10d            
+	jge      .L6                     
+	subq     $4, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -40(%rbp), %r10          # load t to %r10
+	movl     -44(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     (%r10), %r10d           
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L5:	# step expression of FOR statement
+	movl     -44(%rbp), %r10d         # fetch result before in/decrement as expression value
+	addl     $1, -44(%rbp)            # ++ i  
+	jmp      .L4                     
+.L6:	# FOR statement done
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $44, %rsp                # rewind stack before jump
+.L3:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
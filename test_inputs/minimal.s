@@ -0,0 +1,81 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "%d %d %d\n"            
+	.bss                             
+	.align   4                       
+	.type    static_int, @object     
+	.size    static_int, 4           
+static_int:
+	.zero    4                       
+	.globl   plain_int               
+	.align   4                       
+	.type    plain_int, @object      
+	.size    plain_int, 4            
+plain_int:
+	.zero    4                       
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -1(%rbp), %r10           # load address of a into %r10
+	movl     $97, %r11d              
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+	leaq     -2(%rbp), %r10           # load address of b into %r10
+	movl     $98, %r11d              
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+	leaq     -3(%rbp), %r10           # load address of c into %r10
+	movl     $4627, %r11d            
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+	leaq     -4(%rbp), %r10           # load address of d into %r10
+	movl     $89, %r11d              
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+	leaq     static_int(%rip), %r10   # load address of static_int into %r10
+	movl     $1, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     plain_int(%rip), %r10    # load address of plain_int into %r10
+	movl     $2, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -8(%rbp), %r10           # load address of local_static_int into %r10
+	movl     $3, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -2(%rbp), %r10           # load address of b into %r10
+	movl     $4, %r11d               
+	movb     %r11b, (%r10)            # store %r11b in *%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movl     -8(%rbp), %r10d          # load local_static_int to %r10d
+	movl     %r10d, %ecx              # Move argument #3 to %ecx
+	movl     plain_int(%rip), %r10d   # load plain_int to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movl     static_int(%rip), %r10d  # load static_int to %r10d
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $8, %rsp                 # rewind stack before jump
+.L2:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
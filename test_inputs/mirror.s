@@ -0,0 +1,99 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "Enter a number: "      
+.L2:
+	.string  "%d"                    
+.L3:
+	.string  "The mirror image of %d is %d.\n"
+	.bss                             
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $4, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -4(%rbp), %r10           # load  &n to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -12(%rbp), %r10          # load address of mirror into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -8(%rbp), %r10           # load address of tmp into %r10
+	movl     -4(%rbp), %r11d          # load n to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L5:	# condition of WHILE statement
+	movl     -8(%rbp), %r10d          # load tmp to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L6                     
+	leaq     -12(%rbp), %r10          # load address of mirror into %r10
+	movl     -12(%rbp), %r11d         # load mirror to %r11d
+	movl     $10, %r12d              
+	imull    %r12d, %r11d            
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -12(%rbp), %r10          # load address of mirror into %r10
+	movl     -12(%rbp), %r11d         # load mirror to %r11d
+	movl     -8(%rbp), %r12d          # load tmp to %r12d
+	movl     $10, %r13d              
+	movl     %r12d, %eax             
+	cdq                              
+	idivl    %r13d                   
+	movl     %edx, %r12d             
+	addl     %r12d, %r11d            
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -8(%rbp), %r10           # load address of tmp into %r10
+	movl     -8(%rbp), %r11d          # load tmp to %r11d
+	movl     $10, %r12d              
+	movl     %r11d, %eax             
+	cdq                              
+	idivl    %r12d                   
+	movl     %eax, %r11d             
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	jmp      .L5                     
+.L6:	# WHILE statement done
+	subq     $4, %rsp                 # Stack alignment before 64-bit function call
+	movl     -12(%rbp), %r10d         # load mirror to %r10d
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movl     -4(%rbp), %r10d          # load n to %r10d
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $12, %rsp                # rewind stack before jump
+.L4:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,207 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "How many primes should I list?: "
+.L2:
+	.string  "%d"                    
+.L3:
+	.string  "The %5d-th prime is %5d\n"
+	.bss                             
+	.text                            
+	.globl   is_prime                
+	.type    is_prime, @function     
+is_prime:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movl     %edi, -4(%rbp)           # save d to stack
+	movq     %rsi, -16(%rbp)          # save primes to stack
+	subq     $4, %rsp                 # alloc for automatic variables on stack
+	leaq     -20(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L5:	# condition of FOR statement
+	movq     -16(%rbp), %r10          # load primes to %r10
+	movl     -20(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     (%r10), %r10d           
+	movq     -16(%rbp), %r11          # load primes to %r11
+	movl     -20(%rbp), %r12d         # load i to %r12d
+	movslq   %r12d, %r12              # upcasting from %r12d to %r12
+	leaq     (%r11,%r12,4), %r11     
+	movl     (%r11), %r11d           
+	imull    %r11d, %r10d            
+	movl     -4(%rbp), %r11d          # load d to %r11d
+	cmpl     %r11d, %r10d            
+	jg       .L7                     
+	movl     -4(%rbp), %r10d          # load d to %r10d
+	movq     -16(%rbp), %r11          # load primes to %r11
+	movl     -20(%rbp), %r12d         # load i to %r12d
+	movslq   %r12d, %r12              # upcasting from %r12d to %r12
+	leaq     (%r11,%r12,4), %r11     
+	movl     (%r11), %r11d           
+	movl     %r10d, %eax             
+	cdq                              
+	idivl    %r11d                   
+	movl     %edx, %r10d             
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L9                     
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $20, %rsp                # rewind stack before jump
+	jmp      .L4                     
+.L9:	# end of IF statement
+.L6:	# step expression of FOR statement
+	movl     -20(%rbp), %r10d         # fetch result before in/decrement as expression value
+	addl     $1, -20(%rbp)            # ++ i  
+	jmp      .L5                     
+.L7:	# FOR statement done
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $20, %rsp                # rewind stack before jump
+.L4:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $32, %rsp                # alloc for automatic variables on stack
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -4(%rbp), %r10           # load  &n to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -16(%rbp), %r10          # load address of primes into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movl     -4(%rbp), %r10d          # load n to %r10d
+	movslq   %r10d, %r10              # upcasting from %r10d to %r10
+	movq     $4, %r11                
+	movq     %r10, %rax              
+	mulq     %r11                    
+	movq     %rax, %r10              
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load primes to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     $2, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	movq     -16(%rbp), %r10          # load primes to %r10
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     $3, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -24(%rbp), %r10          # load address of d into %r10
+	movl     $5, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -20(%rbp), %r10          # load address of i into %r10
+	movl     $2, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L11:	# condition of FOR statement
+	movl     -20(%rbp), %r10d         # load i to %r10d
+	movl     -4(%rbp), %r11d          # load n to %r11d
+	cmpl     %r11d, %r10d            
+	jge      .L13                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load primes to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movl     -24(%rbp), %r10d         # load d to %r10d
+	movl     %r10d, %edi              # Move argument #0 to %edi
+	callq    is_prime@PLT            
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	testl    %r10d, %r10d            
+	jz       .L15                    
+	movq     -16(%rbp), %r10          # load primes to %r10
+	movl     -20(%rbp), %r11d         # fetch result before in/decrement as expression value
+	addl     $1, -20(%rbp)            # ++ i  
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     -24(%rbp), %r11d         # load d to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load primes to %r10
+	movl     -20(%rbp), %r11d         # load i to %r11d
+	movl     $1, %r12d               
+	subl     %r12d, %r11d            
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     (%r10), %r10d           
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movl     -20(%rbp), %r10d         # load i to %r10d
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L15:	# end of IF statement
+.L12:	# step expression of FOR statement
+	leaq     -24(%rbp), %r10          # load address of d into %r10
+	movl     -24(%rbp), %r11d         # load d to %r11d
+	movl     $1, %r12d               
+	addl     %r12d, %r11d            
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	jmp      .L11                    
+.L13:	# FOR statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load primes to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+.L10:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,233 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "*"                     
+.L2:
+	.string  "\n"                    
+	.bss                             
+	.text                            
+	.globl   cmp                     
+	.type    cmp, @function          
+cmp:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save a to stack
+	movq     %rsi, -16(%rbp)          # save b to stack
+	movq     -8(%rbp), %r10           # load a to %r10
+	movl     (%r10), %r11d           
+	movq     -16(%rbp), %r10          # load b to %r10
+	movl     (%r10), %r12d           
+	subl     %r12d, %r11d            
+	movl     %r11d, %eax             
+	addq     $16, %rsp                # rewind stack before jump
+.L3:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   star_print              
+	.type    star_print, @function   
+star_print:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $4, %rsp                 # alloc for automatic variables on stack
+	movl     %edi, -4(%rbp)           # save v to stack
+	subq     $4, %rsp                 # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L5:	# condition of FOR statement
+	movl     -8(%rbp), %r10d          # load i to %r10d
+	movl     -4(%rbp), %r11d          # load v to %r11d
+	cmpl     %r11d, %r10d            
+	jge      .L7                     
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L6:	# step expression of FOR statement
+	addl     $1, -8(%rbp)             # ++ i  
+	movl     -8(%rbp), %r10d          # fetch in/decremented result as expression value
+	jmp      .L5                     
+.L7:	# FOR statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	addq     $8, %rsp                 # remove automatic variables from stack
+.L4:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   print_array             
+	.type    print_array, @function  
+print_array:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save a to stack
+	movq     %rsi, -16(%rbp)          # save n to stack
+	movq     %rdx, -24(%rbp)          # save print to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -32(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L9:	# condition of FOR statement
+	movq     -32(%rbp), %r10          # load i to %r10
+	movq     -16(%rbp), %r11          # load n to %r11
+	cmpq     %r11, %r10              
+	jae      .L11                    
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -32(%rbp), %r11          # load i to %r11
+	leaq     (%r10,%r11,4), %r10     
+	movl     (%r10), %r10d           
+	movl     %r10d, %edi              # Move argument #0 to %edi
+	movq     -24(%rbp), %r10          # load print to %r10
+	callq    *%r10                   
+.L10:	# step expression of FOR statement
+	addq     $1, -32(%rbp)            # ++ i  
+	movq     -32(%rbp), %r10          # fetch in/decremented result as expression value
+	jmp      .L9                     
+.L11:	# FOR statement done
+	addq     $32, %rsp                # remove automatic variables from stack
+.L8:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $84, %rsp                # alloc for automatic variables on stack
+	leaq     -84(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L13:	# condition of FOR statement
+	movl     -84(%rbp), %r10d         # load i to %r10d
+	movl     $20, %r11d              
+	cmpl     %r11d, %r10d            
+	jge      .L15                    
+	leaq     -80(%rbp), %r10          # load a to %r10
+	movl     -84(%rbp), %r11d         # load i to %r11d
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,4), %r10     
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $4, %rsp                 # Stack alignment before 64-bit function call
+	callq    rand@PLT                
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movl     %eax, %r11d              # move return value to %r11d
+	movl     $100, %r12d             
+	movl     %r11d, %eax             
+	cdq                              
+	idivl    %r12d                   
+	movl     %edx, %r11d             
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L14:	# step expression of FOR statement
+	addl     $1, -84(%rbp)            # ++ i  
+	movl     -84(%rbp), %r10d         # fetch in/decremented result as expression value
+	jmp      .L13                    
+.L15:	# FOR statement done
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     star_print@GOTPCREL(%rip), %r10 # load star_print to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $20, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -80(%rbp), %r10          # load a to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    print_array@PLT         
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $12, %rsp                # Stack alignment before 64-bit function call
+	movq     cmp@GOTPCREL(%rip), %r10 # load cmp to %r10
+	movq     %r10, %rcx               # Move argument #3 to %rcx
+	movq     $4, %r10                
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $20, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -80(%rbp), %r10          # load a to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    qsort@PLT               
+	movq     star_print@GOTPCREL(%rip), %r10 # load star_print to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movl     $20, %r10d              
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -80(%rbp), %r10          # load a to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    print_array@PLT         
+	addq     $12, %rsp                # Stack realignment after 64-bit function call
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $84, %rsp                # rewind stack before jump
+.L12:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,122 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "We search for the root of x^2-2 between a and b with precision eps.\n"
+.L2:
+	.string  "a, b, eps: "           
+.L3:
+	.string  "%lf%lf%lf"             
+.L4:
+	.string  "The root is: %.10f\n"  
+	.align   8                       
+.L5:
+	.long    0                        # 2.000000
+	.long    1073741824              
+	.align   8                       
+.L6:
+	.long    0                        # 0.000000
+	.long    0                       
+	.bss                             
+	.globl   scanf                   
+	.align   0                       
+	.type    scanf, @object          
+	.size    scanf, 0                
+scanf:
+	.zero    0                       
+	.globl   printf                  
+	.align   0                       
+	.type    printf, @object         
+	.size    printf, 0               
+printf:
+	.zero    0                       
+	.text                            
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $32, %rsp                # alloc for automatic variables on stack
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -32(%rbp), %r10          # load  &eps to %r10
+	movq     %r10, %rcx               # Move argument #3 to %rcx
+	leaq     -16(%rbp), %r10          # load  &b to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     -8(%rbp), %r10           # load  &a to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	movl     %eax, %r10d              # move return value to %r10d
+.L8:	# condition of WHILE statement
+	movsd    -16(%rbp), %xmm15        # load b to %xmm15
+	movsd    -8(%rbp), %xmm14         # load a to %xmm14
+	subsd    %xmm14, %xmm15          
+	movsd    -32(%rbp), %xmm14        # load eps to %xmm14
+	comisd   %xmm14, %xmm15          
+	jbe      .L9                     
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -40(%rbp), %r10          # load address of x into %r10
+	movsd    -8(%rbp), %xmm15         # load a to %xmm15
+	movsd    -16(%rbp), %xmm14        # load b to %xmm14
+	addsd    %xmm14, %xmm15          
+	movsd    .L5(%rip), %xmm14       
+	divsd    %xmm14, %xmm15          
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	movsd    -40(%rbp), %xmm15        # load x to %xmm15
+	movsd    -40(%rbp), %xmm14        # load x to %xmm14
+	mulsd    %xmm14, %xmm15          
+	movsd    .L5(%rip), %xmm14       
+	subsd    %xmm14, %xmm15          
+	movsd    .L6(%rip), %xmm14       
+	comisd   %xmm14, %xmm15          
+	jae      .L10                    
+	leaq     -8(%rbp), %r10           # load address of a into %r10
+	movsd    -40(%rbp), %xmm15        # load x to %xmm15
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	jmp      .L11                    
+.L10:	# else branch of IF statement
+	leaq     -16(%rbp), %r10          # load address of b into %r10
+	movsd    -40(%rbp), %xmm15        # load x to %xmm15
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+.L11:	# end of IF statement
+	addq     $8, %rsp                 # remove automatic variables from stack
+	jmp      .L8                     
+.L9:	# WHILE statement done
+	movsd    -8(%rbp), %xmm15         # load a to %xmm15
+	movsd    %xmm15, %xmm0            # Move argument #1 to %xmm0
+	leaq     .L4(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $1, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $32, %rsp                # rewind stack before jump
+.L7:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,443 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "%.0f, "                
+.L2:
+	.string  "\n"                    
+	.bss                             
+	.globl   rand                    
+	.align   0                       
+	.type    rand, @object           
+	.size    rand, 0                 
+rand:
+	.zero    0                       
+	.globl   scanf                   
+	.align   0                       
+	.type    scanf, @object          
+	.size    scanf, 0                
+scanf:
+	.zero    0                       
+	.globl   printf                  
+	.align   0                       
+	.type    printf, @object         
+	.size    printf, 0               
+printf:
+	.zero    0                       
+	.text                            
+	.globl   swap                    
+	.type    swap, @function         
+swap:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save a to stack
+	movq     %rsi, -16(%rbp)          # save b to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of x into %r10
+	movq     -8(%rbp), %r11           # load a to %r11
+	movsd    (%r11), %xmm15          
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -16(%rbp), %r11          # load b to %r11
+	movsd    (%r11), %xmm15          
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	movq     -16(%rbp), %r10          # load b to %r10
+	movsd    -24(%rbp), %xmm15        # load x to %xmm15
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	addq     $24, %rsp                # remove automatic variables from stack
+.L3:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   bubble                  
+	.type    bubble, @function       
+bubble:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save a to stack
+	movq     %rsi, -16(%rbp)          # save n to stack
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L5:	# condition of FOR statement
+	movq     -24(%rbp), %r10          # load i to %r10
+	movq     -16(%rbp), %r11          # load n to %r11
+	movl     $1, %r12d               
+	movslq   %r12d, %r12              # upcasting from %r12d to %r12
+	subq     %r12, %r11              
+	cmpq     %r11, %r10              
+	jae      .L7                     
+	leaq     -32(%rbp), %r10          # load address of j into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L8:	# condition of FOR statement
+	movq     -32(%rbp), %r10          # load j to %r10
+	movq     -16(%rbp), %r11          # load n to %r11
+	movq     -24(%rbp), %r12          # load i to %r12
+	subq     %r12, %r11              
+	movl     $1, %r12d               
+	movslq   %r12d, %r12              # upcasting from %r12d to %r12
+	subq     %r12, %r11              
+	cmpq     %r11, %r10              
+	jae      .L10                    
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -32(%rbp), %r11          # load j to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movsd    (%r10), %xmm15          
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -32(%rbp), %r11          # load j to %r11
+	movl     $1, %r12d               
+	movslq   %r12d, %r12              # upcasting from %r12d to %r12
+	addq     %r12, %r11              
+	leaq     (%r10,%r11,8), %r10     
+	movsd    (%r10), %xmm14          
+	comisd   %xmm14, %xmm15          
+	jb       .L12                    
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -32(%rbp), %r11          # load j to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -32(%rbp), %r11          # load j to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    swap@PLT                
+.L12:	# end of IF statement
+.L9:	# step expression of FOR statement
+	addq     $1, -32(%rbp)            # ++ j  
+	movq     -32(%rbp), %r10          # fetch in/decremented result as expression value
+	jmp      .L8                     
+.L10:	# FOR statement done
+.L6:	# step expression of FOR statement
+	addq     $1, -24(%rbp)            # ++ i  
+	movq     -24(%rbp), %r10          # fetch in/decremented result as expression value
+	jmp      .L5                     
+.L7:	# FOR statement done
+	addq     $32, %rsp                # remove automatic variables from stack
+.L4:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   quick                   
+	.type    quick, @function        
+quick:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save a to stack
+	movq     %rsi, -16(%rbp)          # save n to stack
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -32(%rbp), %r10          # load address of j into %r10
+	movq     -16(%rbp), %r11          # load n to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -40(%rbp), %r10          # load address of pivot into %r10
+	movq     -8(%rbp), %r11           # load a to %r11
+	movq     -16(%rbp), %r12          # load n to %r12
+	movl     $2, %r13d               
+	movslq   %r13d, %r13              # upcasting from %r13d to %r13
+	movq     %r12, %rax              
+	cqo                              
+	divq     %r13                    
+	movq     %rax, %r12              
+	leaq     (%r11,%r12,8), %r11     
+	movsd    (%r11), %xmm15          
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+.L14:	# condition of WHILE statement
+	movq     -24(%rbp), %r10          # load i to %r10
+	movq     -32(%rbp), %r11          # load j to %r11
+	cmpq     %r11, %r10              
+	jae      .L15                    
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movsd    (%r10), %xmm15          
+	movsd    -40(%rbp), %xmm14        # load pivot to %xmm14
+	comisd   %xmm14, %xmm15          
+	jae      .L16                    
+	addq     $1, -24(%rbp)            # ++ i  
+	movq     -24(%rbp), %r10          # fetch in/decremented result as expression value
+	jmp      .L17                    
+.L16:	# else branch of IF statement
+	subq     $1, -32(%rbp)            # -- j  
+	movq     -32(%rbp), %r10          # fetch in/decremented result as expression value
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -32(%rbp), %r11          # load j to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movsd    (%r10), %xmm15          
+	movsd    -40(%rbp), %xmm14        # load pivot to %xmm14
+	comisd   %xmm14, %xmm15          
+	ja       .L19                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -32(%rbp), %r11          # load j to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    swap@PLT                
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+.L19:	# end of IF statement
+.L17:	# end of IF statement
+	jmp      .L14                    
+.L15:	# WHILE statement done
+	movq     -24(%rbp), %r10          # load i to %r10
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jbe      .L21                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load i to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    quick@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+.L21:	# end of IF statement
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movsd    (%r10), %xmm15          
+	movsd    -40(%rbp), %xmm14        # load pivot to %xmm14
+	comisd   %xmm14, %xmm15          
+	jne      .L22                    
+	movq     -16(%rbp), %r10          # load n to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	subq     %r11, %r10              
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	subq     %r11, %r10              
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jbe      .L25                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load n to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	subq     %r11, %r10              
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	subq     %r11, %r10              
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    quick@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+.L25:	# end of IF statement
+	jmp      .L23                    
+.L22:	# else branch of IF statement
+	movq     -16(%rbp), %r10          # load n to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	subq     %r11, %r10              
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jbe      .L27                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load n to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	subq     %r11, %r10              
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -8(%rbp), %r10           # load a to %r10
+	movq     -24(%rbp), %r11          # load i to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    quick@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+.L27:	# end of IF statement
+.L23:	# end of IF statement
+	addq     $40, %rsp                # remove automatic variables from stack
+.L13:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8008, %rsp              # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of i into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L29:	# condition of FOR statement
+	movq     -8(%rbp), %r10           # load i to %r10
+	movl     $1000, %r11d            
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jae      .L31                    
+	leaq     -8008(%rbp), %r10        # load array to %r10
+	movq     -8(%rbp), %r11           # load i to %r11
+	leaq     (%r10,%r11,8), %r10     
+	pushq    %r10                     # Preserve value in register%r10
+	callq    rand@PLT                
+	popq     %r10                     # Restore value in register %r10
+	movl     %eax, %r11d              # move return value to %r11d
+	movl     $2000, %r12d            
+	movl     %r11d, %eax             
+	cdq                              
+	idivl    %r12d                   
+	movl     %edx, %r11d             
+	cvtsi2sd %r11d, %xmm15           
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+.L30:	# step expression of FOR statement
+	addq     $1, -8(%rbp)             # ++ i  
+	movq     -8(%rbp), %r10           # fetch in/decremented result as expression value
+	jmp      .L29                    
+.L31:	# FOR statement done
+	leaq     -8(%rbp), %r10           # load address of i into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L32:	# condition of FOR statement
+	movq     -8(%rbp), %r10           # load i to %r10
+	movl     $1000, %r11d            
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jae      .L34                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -8008(%rbp), %r10        # load array to %r10
+	movq     -8(%rbp), %r11           # load i to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movsd    (%r10), %xmm15          
+	movsd    %xmm15, %xmm0            # Move argument #1 to %xmm0
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $1, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L33:	# step expression of FOR statement
+	addq     $1, -8(%rbp)             # ++ i  
+	movq     -8(%rbp), %r10           # fetch in/decremented result as expression value
+	jmp      .L32                    
+.L34:	# FOR statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movl     $1000, %r10d            
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -8008(%rbp), %r10        # load array to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    quick@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	leaq     -8(%rbp), %r10           # load address of i into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L35:	# condition of FOR statement
+	movq     -8(%rbp), %r10           # load i to %r10
+	movl     $1000, %r11d            
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jae      .L37                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -8008(%rbp), %r10        # load array to %r10
+	movq     -8(%rbp), %r11           # load i to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movsd    (%r10), %xmm15          
+	movsd    %xmm15, %xmm0            # Move argument #1 to %xmm0
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $1, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+.L36:	# step expression of FOR statement
+	addq     $1, -8(%rbp)             # ++ i  
+	movq     -8(%rbp), %r10           # fetch in/decremented result as expression value
+	jmp      .L35                    
+.L37:	# FOR statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $8008, %rsp              # rewind stack before jump
+.L28:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
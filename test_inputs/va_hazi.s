@@ -0,0 +1,1193 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "Memory allocation unsuccesful\n"
+.L2:
+	.string  "r"                     
+.L3:
+	.string  "Could not open file containing moon data\n"
+.L4:
+	.string  "Nev: %[^\n]\nTomeg:%lf\nBolygoja:%[^\n]\n"
+.L5:
+	.string  "Could not close file containing moon data\n"
+.L6:
+	.string  "Could not open file containing planet data\n"
+.L7:
+	.string  "Nev: %[^\n]\nTomeg:%lf\nCsillaga:%[^\n]\nKeringesi ideje: %lf\n"
+.L8:
+	.string  "Sziderikus forgasido:%lf\n"
+.L9:
+	.string  "Could not close file containing planet data\n"
+.L10:
+	.string  "Yes, planet %s, from %s's solar system matches the requirements."
+.L11:
+	.string  "No, there's no such planet in the database."
+.L12:
+	.string  "Problem creating empty moon list"
+.L13:
+	.string  "Problem creating empty planet list"
+.L14:
+	.string  "Please enter the name of the star of the chosen solar system:"
+.L15:
+	.string  "%[^\n]"                
+	.align   8                       
+.L16:
+	.long    0                        # 1.000000
+	.long    1072693248              
+	.bss                             
+	.text                            
+	.globl   create_m_list           
+	.type    create_m_list, @function
+create_m_list:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of p into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     $48, %r10               
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -16(%rbp), %r10          # load address of d into %r10
+	movsd    .L16(%rip), %xmm15      
+	pxor     %xmm14, %xmm14          
+	subsd    %xmm15, %xmm14           # floating point negate (0.0 - %xmm15)
+	movsd    %xmm14, (%r10)           # store %xmm14 in *%r10
+	movq     -8(%rbp), %r10           # load p to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L19                    
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     -8(%rbp), %r10           # load p to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+	jmp      .L17                    
+.L19:	# end of IF statement
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $40, %r10                # Apply offset of member next
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     $48, %r10               
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	addq     $40, %r10                # Apply offset of member next
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load p to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+.L17:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   create_p_list           
+	.type    create_p_list, @function
+create_p_list:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of p into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movq     $72, %r10               
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load p to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L22                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movq     -8(%rbp), %r10           # load p to %r10
+	movq     %r10, %rax              
+	addq     $8, %rsp                 # rewind stack before jump
+	jmp      .L20                    
+.L22:	# end of IF statement
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $64, %r10                # Apply offset of member next
+	pushq    %r10                     # Preserve value in register%r10
+	movq     $72, %r10               
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $64, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	addq     $64, %r10                # Apply offset of member next
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $64, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	addq     $56, %r10                # Apply offset of member moons
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $56, %r10                # Apply offset of member moons
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load p to %r10
+	movq     %r10, %rax              
+	addq     $8, %rsp                 # rewind stack before jump
+.L20:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   fill_moon_list          
+	.type    fill_moon_list, @function
+fill_moon_list:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	movq     %rsi, -16(%rbp)          # save f to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of fm into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load f to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fopen@PLT               
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -24(%rbp), %r10          # load fm to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L25                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+	jmp      .L23                    
+.L25:	# end of IF statement
+.L26:	# condition of WHILE statement
+	movl     $1, %r10d               
+	testl    %r10d, %r10d            
+	jz       .L27                    
+	subq     $56, %rsp                # alloc for automatic variables on stack
+	leaq     -64(%rbp), %r10          # load d to %r10
+	addq     $15, %r10                # Apply offset of member planet
+	movq     %r10, %r8                # Move argument #4 to %r8
+	leaq     -64(%rbp), %r10          # load d to %r10
+	addq     $32, %r10                # Apply offset of member mass
+	movq     %r10, %rcx               # Move argument #3 to %rcx
+	leaq     -64(%rbp), %r10          # load d to %r10
+	addq     $0, %r10                 # Apply offset of member name
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     .L4(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -24(%rbp), %r10          # load fm to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fscanf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r11d               
+	negl     %r11d                   
+	cmpl     %r11d, %r10d            
+	jne      .L29                    
+	addq     $48, %rsp                # rewind stack before jump
+	jmp      .L27                    
+.L29:	# end of IF statement
+	leaq     -72(%rbp), %r10          # load address of m into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movq     $48, %r10               
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -72(%rbp), %r10          # load m to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L31                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $72, %rsp                # rewind stack before jump
+	jmp      .L23                    
+.L31:	# end of IF statement
+	movq     -72(%rbp), %r10          # load m to %r10
+	addq     $0, %r10                 # Apply offset of member d
+	leaq     -64(%rbp), %r11          # load d to %r11
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     -72(%rbp), %r10          # load m to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movq     -72(%rbp), %r11          # load m to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	addq     $48, %rsp                # remove automatic variables from stack
+	jmp      .L26                    
+.L27:	# WHILE statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load fm to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fclose@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L33                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L5(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+	jmp      .L23                    
+.L33:	# end of IF statement
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+.L23:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   attach_moons            
+	.type    attach_moons, @function 
+attach_moons:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save phead to stack
+	movq     %rsi, -16(%rbp)          # save mhead to stack
+	subq     $24, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of p into %r10
+	movq     -8(%rbp), %r11           # load phead to %r11
+	addq     $64, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movl     $1, %r10d               
+.L35:	# condition of FOR statement
+	movq     -24(%rbp), %r10          # load p to %r10
+	addq     $64, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L37                    
+	leaq     -32(%rbp), %r10          # load address of m into %r10
+	movq     -16(%rbp), %r11          # load mhead to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -40(%rbp), %r10          # load address of mprev into %r10
+	movq     -16(%rbp), %r11          # load mhead to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L38:	# condition of WHILE statement
+	movq     -32(%rbp), %r10          # load m to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L39                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -32(%rbp), %r10          # load m to %r10
+	addq     $0, %r10                 # Apply offset of member d
+	addq     $15, %r10                # Apply offset of member planet
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -24(%rbp), %r10          # load p to %r10
+	addq     $0, %r10                 # Apply offset of member d
+	addq     $0, %r10                 # Apply offset of member name
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L40                    
+	movq     -40(%rbp), %r10          # load mprev to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movq     -32(%rbp), %r11          # load m to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -32(%rbp), %r10          # load m to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movq     -24(%rbp), %r11          # load p to %r11
+	addq     $56, %r11                # Apply offset of member moons
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -24(%rbp), %r10          # load p to %r10
+	addq     $56, %r10                # Apply offset of member moons
+	movq     -32(%rbp), %r11          # load m to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -32(%rbp), %r10          # load address of m into %r10
+	movq     -40(%rbp), %r11          # load mprev to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L41                    
+.L40:	# else branch of IF statement
+	leaq     -32(%rbp), %r10          # load address of m into %r10
+	movq     -32(%rbp), %r11          # load m to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -40(%rbp), %r10          # load address of mprev into %r10
+	movq     -40(%rbp), %r11          # load mprev to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L41:	# end of IF statement
+	jmp      .L38                    
+.L39:	# WHILE statement done
+.L36:	# step expression of FOR statement
+	leaq     -24(%rbp), %r10          # load address of p into %r10
+	movq     -24(%rbp), %r11          # load p to %r11
+	addq     $64, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L35                    
+.L37:	# FOR statement done
+	addq     $40, %rsp                # remove automatic variables from stack
+.L34:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   fill_planet_list        
+	.type    fill_planet_list, @function
+fill_planet_list:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	movq     %rsi, -16(%rbp)          # save f to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of fp into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load f to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fopen@PLT               
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -24(%rbp), %r10          # load fp to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L44                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L6(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+	jmp      .L42                    
+.L44:	# end of IF statement
+.L45:	# condition of WHILE statement
+	movl     $1, %r10d               
+	testl    %r10d, %r10d            
+	jz       .L46                    
+	subq     $72, %rsp                # alloc for automatic variables on stack
+	leaq     -80(%rbp), %r10          # load d to %r10
+	addq     $40, %r10                # Apply offset of member T
+	movq     %r10, %r9                # Move argument #5 to %r9
+	leaq     -80(%rbp), %r10          # load d to %r10
+	addq     $15, %r10                # Apply offset of member star
+	movq     %r10, %r8                # Move argument #4 to %r8
+	leaq     -80(%rbp), %r10          # load d to %r10
+	addq     $32, %r10                # Apply offset of member mass
+	movq     %r10, %rcx               # Move argument #3 to %rcx
+	leaq     -80(%rbp), %r10          # load d to %r10
+	addq     $0, %r10                 # Apply offset of member name
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     .L7(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -24(%rbp), %r10          # load fp to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fscanf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r11d               
+	negl     %r11d                   
+	cmpl     %r11d, %r10d            
+	jne      .L48                    
+	addq     $64, %rsp                # rewind stack before jump
+	jmp      .L46                    
+.L48:	# end of IF statement
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -80(%rbp), %r10          # load d to %r10
+	addq     $48, %r10                # Apply offset of member Tr
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     .L8(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -24(%rbp), %r10          # load fp to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fscanf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	leaq     -88(%rbp), %r10          # load address of p into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movq     $72, %r10               
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -88(%rbp), %r10          # load p to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L50                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $88, %rsp                # rewind stack before jump
+	jmp      .L42                    
+.L50:	# end of IF statement
+	movq     -88(%rbp), %r10          # load p to %r10
+	addq     $0, %r10                 # Apply offset of member d
+	leaq     -80(%rbp), %r11          # load d to %r11
+	movq     (%r11), %r12            
+	movq     %r12, (%r10)            
+	movq     8(%r11), %r12           
+	movq     %r12, 8(%r10)           
+	movq     16(%r11), %r12          
+	movq     %r12, 16(%r10)          
+	movq     24(%r11), %r12          
+	movq     %r12, 24(%r10)          
+	movq     32(%r11), %r12          
+	movq     %r12, 32(%r10)          
+	movq     40(%r11), %r12          
+	movq     %r12, 40(%r10)          
+	movq     48(%r11), %r12          
+	movq     %r12, 48(%r10)          
+	movq     -88(%rbp), %r10          # load p to %r10
+	addq     $64, %r10                # Apply offset of member next
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $64, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -8(%rbp), %r10           # load head to %r10
+	addq     $64, %r10                # Apply offset of member next
+	movq     -88(%rbp), %r11          # load p to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -88(%rbp), %r10          # load p to %r10
+	addq     $56, %r10                # Apply offset of member moons
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	addq     $64, %rsp                # remove automatic variables from stack
+	jmp      .L45                    
+.L46:	# WHILE statement done
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load fp to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fclose@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L52                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L9(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+	jmp      .L42                    
+.L52:	# end of IF statement
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $24, %rsp                # rewind stack before jump
+.L42:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   delete_m_list           
+	.type    delete_m_list, @function
+delete_m_list:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+.L54:	# condition of WHILE statement
+	movq     -8(%rbp), %r10           # load head to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L55                    
+	leaq     -16(%rbp), %r10          # load address of p into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -8(%rbp), %r10           # load address of head into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load p to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	jmp      .L54                    
+.L55:	# WHILE statement done
+	movq     -8(%rbp), %r10           # load head to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	addq     $16, %rsp                # remove automatic variables from stack
+.L53:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   delete_p_list           
+	.type    delete_p_list, @function
+delete_p_list:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save head to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+.L57:	# condition of WHILE statement
+	movq     -8(%rbp), %r10           # load head to %r10
+	addq     $64, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L58                    
+	leaq     -16(%rbp), %r10          # load address of p into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load p to %r10
+	addq     $56, %r10                # Apply offset of member moons
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L60                    
+	movq     -16(%rbp), %r10          # load p to %r10
+	addq     $56, %r10                # Apply offset of member moons
+	movq     (%r10), %r10            
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    delete_m_list@PLT       
+.L60:	# end of IF statement
+	leaq     -8(%rbp), %r10           # load address of head into %r10
+	movq     -8(%rbp), %r11           # load head to %r11
+	addq     $64, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load p to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	jmp      .L57                    
+.L58:	# WHILE statement done
+	movq     -8(%rbp), %r10           # load head to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	addq     $16, %rsp                # remove automatic variables from stack
+.L56:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   sum_moon_mass           
+	.type    sum_moon_mass, @function
+sum_moon_mass:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save p to stack
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	leaq     -16(%rbp), %r10          # load address of sum into %r10
+	movsd    .L16(%rip), %xmm15      
+	pxor     %xmm14, %xmm14          
+	subsd    %xmm15, %xmm14           # floating point negate (0.0 - %xmm15)
+	movsd    %xmm14, (%r10)           # store %xmm14 in *%r10
+	leaq     -24(%rbp), %r10          # load address of m into %r10
+	movq     -8(%rbp), %r11           # load p to %r11
+	addq     $56, %r11                # Apply offset of member moons
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L62:	# condition of FOR statement
+	movq     -24(%rbp), %r10          # load m to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L64                    
+	leaq     -16(%rbp), %r10          # load address of sum into %r10
+	movsd    -16(%rbp), %xmm15        # load sum to %xmm15
+	movq     -24(%rbp), %r11          # load m to %r11
+	addq     $0, %r11                 # Apply offset of member d
+	addq     $32, %r11                # Apply offset of member mass
+	movsd    (%r11), %xmm14          
+	addsd    %xmm14, %xmm15          
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+.L63:	# step expression of FOR statement
+	leaq     -24(%rbp), %r10          # load address of m into %r10
+	movq     -24(%rbp), %r11          # load m to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L62                    
+.L64:	# FOR statement done
+	movsd    -16(%rbp), %xmm15        # load sum to %xmm15
+	movsd    %xmm15, %xmm0           
+	addq     $24, %rsp                # rewind stack before jump
+.L61:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   is_there                
+	.type    is_there, @function     
+is_there:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save p to stack
+	movq     %rsi, -16(%rbp)          # save s to stack
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movl     $1, %r10d               
+.L66:	# condition of FOR statement
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $64, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L68                    
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $0, %r10                 # Apply offset of member d
+	addq     $15, %r10                # Apply offset of member star
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load s to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L70                    
+	jmp      .L67                    
+.L70:	# end of IF statement
+	leaq     -24(%rbp), %r10          # load address of q into %r10
+	movq     -8(%rbp), %r11           # load p to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L71:	# condition of FOR statement
+	movq     -24(%rbp), %r10          # load q to %r10
+	addq     $64, %r10                # Apply offset of member next
+	movq     (%r10), %r10            
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L73                    
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movq     -24(%rbp), %r10          # load q to %r10
+	addq     $0, %r10                 # Apply offset of member d
+	addq     $15, %r10                # Apply offset of member star
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load s to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcmp@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L75                    
+	addq     $40, %rsp                # rewind stack before jump
+	jmp      .L72                    
+.L75:	# end of IF statement
+	leaq     -32(%rbp), %r10          # load address of d_year_ratio into %r10
+	movq     -8(%rbp), %r11           # load p to %r11
+	addq     $0, %r11                 # Apply offset of member d
+	addq     $40, %r11                # Apply offset of member T
+	movsd    (%r11), %xmm15          
+	movq     -8(%rbp), %r11           # load p to %r11
+	addq     $0, %r11                 # Apply offset of member d
+	addq     $48, %r11                # Apply offset of member Tr
+	movsd    (%r11), %xmm14          
+	divsd    %xmm14, %xmm15          
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	leaq     -40(%rbp), %r10          # load address of moons_mass into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	movq     -24(%rbp), %r10          # load q to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    sum_moon_mass@PLT       
+	popq     %r10                     # Restore value in register %r10
+	movsd    %xmm0, %xmm15            # move return value to %xmm15
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	movsd    -40(%rbp), %xmm15        # load moons_mass to %xmm15
+	movsd    .L16(%rip), %xmm14      
+	pxor     %xmm13, %xmm13          
+	subsd    %xmm14, %xmm13           # floating point negate (0.0 - %xmm14)
+	comisd   %xmm13, %xmm15          
+	jne      .L77                    
+	addq     $40, %rsp                # rewind stack before jump
+	jmp      .L72                    
+.L77:	# end of IF statement
+	movsd    -32(%rbp), %xmm15        # load d_year_ratio to %xmm15
+	movq     -24(%rbp), %r10          # load q to %r10
+	addq     $0, %r10                 # Apply offset of member d
+	addq     $32, %r10                # Apply offset of member mass
+	movsd    (%r10), %xmm14          
+	movsd    -40(%rbp), %xmm13        # load moons_mass to %xmm13
+	divsd    %xmm13, %xmm14          
+	comisd   %xmm14, %xmm15          
+	jbe      .L79                    
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load s to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	movq     -8(%rbp), %r10           # load p to %r10
+	addq     $0, %r10                 # Apply offset of member d
+	addq     $0, %r10                 # Apply offset of member name
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L10(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $40, %rsp                # rewind stack before jump
+	jmp      .L65                    
+.L79:	# end of IF statement
+	addq     $8, %rsp                 # remove automatic variables from stack
+.L72:	# step expression of FOR statement
+	leaq     -24(%rbp), %r10          # load address of q into %r10
+	movq     -24(%rbp), %r11          # load q to %r11
+	addq     $64, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L71                    
+.L73:	# FOR statement done
+.L67:	# step expression of FOR statement
+	leaq     -8(%rbp), %r10           # load address of p into %r10
+	movq     -8(%rbp), %r11           # load p to %r11
+	addq     $64, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L66                    
+.L68:	# FOR statement done
+	leaq     .L11(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $32, %rsp                # rewind stack before jump
+.L65:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $16, %rsp                # alloc for automatic variables on stack
+	movl     %edi, -4(%rbp)           # save argc to stack
+	movq     %rsi, -16(%rbp)          # save argv to stack
+	subq     $39, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of mhead into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $1, %rsp                 # Stack alignment before 64-bit function call
+	callq    create_m_list@PLT       
+	addq     $1, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -32(%rbp), %r10          # load address of phead into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $1, %rsp                 # Stack alignment before 64-bit function call
+	callq    create_p_list@PLT       
+	addq     $1, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -24(%rbp), %r10          # load mhead to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L82                    
+	subq     $9, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L12(%rip), %r10        
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $9, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $55, %rsp                # rewind stack before jump
+	jmp      .L80                    
+.L82:	# end of IF statement
+	movq     -32(%rbp), %r10          # load phead to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L84                    
+	subq     $9, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L13(%rip), %r10        
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     stderr(%rip), %r10       # load stderr to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fprintf@PLT             
+	addq     $9, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $55, %rsp                # rewind stack before jump
+	jmp      .L80                    
+.L84:	# end of IF statement
+	leaq     -36(%rbp), %r10          # load address of a into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $1, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load argv to %r10
+	movl     $1, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     (%r10), %r10            
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -24(%rbp), %r10          # load mhead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fill_moon_list@PLT      
+	addq     $1, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movl     %eax, %r11d              # move return value to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	leaq     -40(%rbp), %r10          # load address of b into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $1, %rsp                 # Stack alignment before 64-bit function call
+	movq     -16(%rbp), %r10          # load argv to %r10
+	movl     $2, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	leaq     (%r10,%r11,8), %r10     
+	movq     (%r10), %r10            
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -32(%rbp), %r10          # load phead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fill_planet_list@PLT    
+	addq     $1, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movl     %eax, %r11d              # move return value to %r11d
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	movl     -36(%rbp), %r10d         # load a to %r10d
+	movl     $1, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L89                    
+	movl     $0, %r10d               
+	jmp      .L90                    
+.L89:
+	movl     $1, %r10d               
+.L90:
+	testl    %r10d, %r10d            
+	jnz      .L87                    
+	movl     -40(%rbp), %r10d         # load b to %r10d
+	movl     $1, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L91                    
+	movl     $0, %r10d               
+	jmp      .L92                    
+.L91:
+	movl     $1, %r10d               
+.L92:
+	testl    %r10d, %r10d            
+	jnz      .L87                    
+	movl     $0, %r10d               
+	jmp      .L88                    
+.L87:
+	movl     $1, %r10d               
+.L88:
+	testl    %r10d, %r10d            
+	jz       .L86                    
+	subq     $9, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load mhead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    delete_m_list@PLT       
+	movq     -32(%rbp), %r10          # load phead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    delete_p_list@PLT       
+	addq     $9, %rsp                 # Stack realignment after 64-bit function call
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $55, %rsp                # rewind stack before jump
+	jmp      .L80                    
+.L86:	# end of IF statement
+	subq     $9, %rsp                 # Stack alignment before 64-bit function call
+	movq     -24(%rbp), %r10          # load mhead to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -32(%rbp), %r10          # load phead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    attach_moons@PLT        
+	leaq     .L14(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $9, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $9, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -55(%rbp), %r10          # load s to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L15(%rip), %r10        
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	addq     $9, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $9, %rsp                 # Stack alignment before 64-bit function call
+	leaq     -55(%rbp), %r10          # load s to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -32(%rbp), %r10          # load phead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    is_there@PLT            
+	addq     $9, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $9, %rsp                 # Stack alignment before 64-bit function call
+	movq     -32(%rbp), %r10          # load phead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    delete_p_list@PLT       
+	movq     -24(%rbp), %r10          # load mhead to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    delete_m_list@PLT       
+	addq     $9, %rsp                 # Stack realignment after 64-bit function call
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $55, %rsp                # rewind stack before jump
+.L80:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
@@ -0,0 +1,170 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "%lf"                   
+.L2:
+	.string  "Adj meg %d elemet: "   
+.L3:
+	.string  "Az osszeg: %f\n"       
+	.align   8                       
+.L4:
+	.long    0                        # 0.000000
+	.long    0                       
+	.bss                             
+	.text                            
+	.globl   sum                     
+	.type    sum, @function          
+sum:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save a to stack
+	movl     %esi, -12(%rbp)          # save n to stack
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	leaq     -24(%rbp), %r10          # load address of sum into %r10
+	movsd    .L4(%rip), %xmm15       
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+	leaq     -16(%rbp), %r10          # load address of i into %r10
+	movl     $0, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+.L6:	# condition of FOR statement
+	movl     -16(%rbp), %r10d         # load i to %r10d
+	movl     -12(%rbp), %r11d         # load n to %r11d
+	cmpl     %r11d, %r10d            
+	jge      .L8                     
+	leaq     -24(%rbp), %r10          # load address of sum into %r10
+	movsd    -24(%rbp), %xmm15        # load sum to %xmm15
+	movq     -8(%rbp), %r11           # load a to %r11
+	movl     -16(%rbp), %r12d         # fetch result before in/decrement as expression value
+	addl     $1, -16(%rbp)            # ++ i  
+	movslq   %r12d, %r12              # upcasting from %r12d to %r12
+	leaq     (%r11,%r12,8), %r11     
+	movsd    (%r11), %xmm14          
+	addsd    %xmm14, %xmm15          
+	movsd    %xmm15, (%r10)           # store %xmm15 in *%r10
+.L7:	# step expression of FOR statement
+	movl     $1, %r10d               
+	jmp      .L6                     
+.L8:	# FOR statement done
+	movsd    -24(%rbp), %xmm15        # load sum to %xmm15
+	movsd    %xmm15, %xmm0           
+	addq     $24, %rsp                # rewind stack before jump
+.L5:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   load                    
+	.type    load, @function         
+load:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $12, %rsp                # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save a to stack
+	movl     %esi, -12(%rbp)          # save n to stack
+.L10:	# condition of WHILE statement
+	movl     -12(%rbp), %r10d         # fetch result before in/decrement as expression value
+	subl     $1, -12(%rbp)            # -- n  
+	movl     $0, %r11d               
+	cmpl     %r11d, %r10d            
+	je       .L11                    
+	subq     $4, %rsp                 # Stack alignment before 64-bit function call
+	movq     -8(%rbp), %r10           # fetch result before in/decrement as expression value
+	addq     $8, -8(%rbp)             # ++ a  
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    scanf@PLT               
+	addq     $4, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	jmp      .L10                    
+.L11:	# WHILE statement done
+	addq     $12, %rsp                # remove automatic variables from stack
+.L9:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $48, %rsp                # alloc for automatic variables on stack
+	movl     $5, %r10d               
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movl     $5, %r10d               
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -40(%rbp), %r10          # load vector to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    load@PLT                
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movl     $5, %r10d               
+	movl     %r10d, %esi              # Move argument #1 to %esi
+	leaq     -40(%rbp), %r10          # load vector to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    sum@PLT                 
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movsd    %xmm0, %xmm15            # move return value to %xmm15
+	movsd    %xmm15, %xmm0            # Move argument #1 to %xmm0
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $1, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $40, %rsp                # rewind stack before jump
+.L12:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
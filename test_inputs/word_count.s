@@ -0,0 +1,269 @@
+	.data                            
+	.section .rodata                 
+.L1:
+	.string  "%s: %d\n"              
+.L2:
+	.string  "fajl.txt"              
+.L3:
+	.string  "r"                     
+.L4:
+	.string  "Could not open file"   
+.L5:
+	.string  "%s"                    
+	.bss                             
+	.text                            
+	.globl   new_word                
+	.type    new_word, @function     
+new_word:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save word to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -16(%rbp), %r10          # load address of q into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	movq     $48, %r10               
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    malloc@PLT              
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load q to %r10
+	addq     $32, %r10                # Apply offset of member count
+	movl     $1, %r11d               
+	movl     %r11d, (%r10)            # store %r11d in *%r10
+	movq     -8(%rbp), %r10           # load word to %r10
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -16(%rbp), %r10          # load q to %r10
+	addq     $0, %r10                 # Apply offset of member word
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    strcpy@PLT              
+	movq     %rax, %r10               # move return value to %r10
+	movq     -16(%rbp), %r10          # load q to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load q to %r10
+	movq     %r10, %rax              
+	addq     $16, %rsp                # rewind stack before jump
+.L6:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   print_list              
+	.type    print_list, @function   
+print_list:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save list to stack
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -16(%rbp), %r10          # load address of q into %r10
+	movq     -8(%rbp), %r11           # load list to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+.L8:	# condition of FOR statement
+	movq     -16(%rbp), %r10          # load q to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L10                    
+	movq     -16(%rbp), %r10          # load q to %r10
+	addq     $32, %r10                # Apply offset of member count
+	movl     (%r10), %r10d           
+	movl     %r10d, %edx              # Move argument #2 to %edx
+	movq     -16(%rbp), %r10          # load q to %r10
+	addq     $0, %r10                 # Apply offset of member word
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L1(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+.L9:	# step expression of FOR statement
+	leaq     -16(%rbp), %r10          # load address of q into %r10
+	movq     -16(%rbp), %r11          # load q to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	jmp      .L8                     
+.L10:	# FOR statement done
+	addq     $16, %rsp                # remove automatic variables from stack
+.L7:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   delete_list             
+	.type    delete_list, @function  
+delete_list:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	movq     %rdi, -8(%rbp)           # save list to stack
+.L12:	# condition of WHILE statement
+	movq     -8(%rbp), %r10           # load list to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	je       .L13                    
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -8(%rbp), %r10           # load address of list into %r10
+	movq     -8(%rbp), %r11           # load list to %r11
+	addq     $40, %r11                # Apply offset of member next
+	movq     (%r11), %r11            
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -16(%rbp), %r10          # load q to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    free@PLT                
+	addq     $8, %rsp                 # remove automatic variables from stack
+	jmp      .L12                    
+.L13:	# WHILE statement done
+	addq     $8, %rsp                 # remove automatic variables from stack
+.L11:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION
+	.globl   main                    
+	.type    main, @function         
+main:
+	pushq    %rbp                     # save caller stack frame base
+	pushq    %r12                     # save callee-saved register to stack
+	pushq    %r13                     # save callee-saved register to stack
+	pushq    %r14                     # save callee-saved register to stack
+	pushq    %r15                     # save callee-saved register to stack
+	pushq    %rbx                     # save callee-saved register to stack
+	subq     $8, %rsp                 # ensure 16 byte alignment
+	movq     %rsp, %rbp               # establish new stack frame
+	                                  # ------end of function prolog
+	subq     $48, %rsp                # alloc for automatic variables on stack
+	leaq     -48(%rbp), %r10          # load address of list into %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -40(%rbp), %r10          # load address of f into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	subq     $8, %rsp                 # Stack alignment before 64-bit function call
+	leaq     .L3(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	leaq     .L2(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fopen@PLT               
+	addq     $8, %rsp                 # Stack realignment after 64-bit function call
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -40(%rbp), %r10          # load f to %r10
+	movl     $0, %r11d               
+	movslq   %r11d, %r11              # upcasting from %r11d to %r11
+	cmpq     %r11, %r10              
+	jne      .L16                    
+	leaq     .L4(%rip), %r10         
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    printf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r10d               
+	movl     %r10d, %eax             
+	addq     $48, %rsp                # rewind stack before jump
+	jmp      .L14                    
+.L16:	# end of IF statement
+.L17:	# condition of WHILE statement
+	leaq     -30(%rbp), %r10          # load buffer to %r10
+	movq     %r10, %rdx               # Move argument #2 to %rdx
+	leaq     .L5(%rip), %r10         
+	movq     %r10, %rsi               # Move argument #1 to %rsi
+	movq     -40(%rbp), %r10          # load f to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	movl     $0, %eax                 # Number of vector arguments for vararg functions
+	callq    fscanf@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $1, %r11d               
+	cmpl     %r11d, %r10d            
+	jne      .L18                    
+	subq     $8, %rsp                 # alloc for automatic variables on stack
+	leaq     -56(%rbp), %r10          # load address of q into %r10
+	pushq    %r10                     # Preserve value in register%r10
+	leaq     -30(%rbp), %r10          # load buffer to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    new_word@PLT            
+	popq     %r10                     # Restore value in register %r10
+	movq     %rax, %r11               # move return value to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	movq     -56(%rbp), %r10          # load q to %r10
+	addq     $40, %r10                # Apply offset of member next
+	movq     -48(%rbp), %r11          # load list to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	leaq     -48(%rbp), %r10          # load address of list into %r10
+	movq     -56(%rbp), %r11          # load q to %r11
+	movq     %r11, (%r10)             # store %r11 in *%r10
+	addq     $8, %rsp                 # remove automatic variables from stack
+	jmp      .L17                    
+.L18:	# WHILE statement done
+	movq     -48(%rbp), %r10          # load list to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    print_list@PLT          
+	movq     -48(%rbp), %r10          # load list to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    delete_list@PLT         
+	movq     -40(%rbp), %r10          # load f to %r10
+	movq     %r10, %rdi               # Move argument #0 to %rdi
+	callq    fclose@PLT              
+	movl     %eax, %r10d              # move return value to %r10d
+	movl     $0, %r10d               
+	movl     %r10d, %eax             
+	addq     $48, %rsp                # rewind stack before jump
+.L14:	# return point of function
+	                                  # ------start of function epilog
+	movq     %rbp, %rsp               # restore caller stack pointer
+	addq     $8, %rsp                 # remove 16 byte padding
+	popq     %rbx                     # restore callee-saved registers
+	popq     %r15                     # restore callee-saved registers
+	popq     %r14                     # restore callee-saved registers
+	popq     %r13                     # restore callee-saved registers
+	popq     %r12                     # restore callee-saved registers
+	popq     %rbp                     # restore caller stack frame base
+	ret                               # end of FUNCTION